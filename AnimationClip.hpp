@@ -0,0 +1,93 @@
+#ifndef ANIMATIONCLIP_H_
+#define ANIMATIONCLIP_H_
+
+#include "TextureRegistry.hpp"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief A small integer identifying a registered AnimationClip, 0 means no clip.
+     * @sharedapi
+     */
+    using AnimationClipHandle = std::uint32_t;
+
+    /**
+     * @brief An immutable sequence of frames, shared by every Animator that plays it.
+     * @sharedapi
+     */
+    struct AnimationClip {
+        /**
+         * @brief The texture of every frame.
+         */
+        std::vector<TextureHandle> frames;
+
+        /**
+         * @brief The time in seconds every frame is shown, same length as frames.
+         */
+        std::vector<float> durations;
+
+        /**
+         * @brief Create a clip from texture paths that all show for the same time.
+         * @param textures The paths of the frames, interned in the engine's TextureRegistry.
+         * @param fps The amount of frames per second.
+         * @return The clip.
+         * @sharedapi
+         */
+        static AnimationClip FromTextures(const std::vector<std::string>& textures, int fps);
+    };
+
+    /**
+     * @brief Owns all animation clips, so identical clips are stored once.
+     * @sharedapi
+     */
+    class AnimationClipLibrary {
+        public:
+            static constexpr AnimationClipHandle InvalidHandle = 0;
+
+            /**
+             * @brief Register a clip under a name, replacing a previous clip with that name.
+             * @param name The name of the clip, e.g. "enemy/walk".
+             * @param clip The clip.
+             * @return The handle of the clip.
+             * @sharedapi
+             */
+            AnimationClipHandle Register(const std::string& name, AnimationClip clip);
+
+            /**
+             * @brief Register a clip without a name, returning the handle of an identical clip if there is one.
+             * @param clip The clip.
+             * @return The handle of the clip.
+             * @sharedapi
+             */
+            AnimationClipHandle Intern(AnimationClip clip);
+
+            /**
+             * @brief Find a clip by name.
+             * @param name The name of the clip.
+             * @return The handle of the clip, or InvalidHandle if it is not registered.
+             * @sharedapi
+             */
+            AnimationClipHandle Find(const std::string& name) const;
+
+            /**
+             * @brief Get a clip.
+             * @param handle A valid handle.
+             * @return The clip.
+             * @sharedapi
+             */
+            const AnimationClip& Get(AnimationClipHandle handle) const { return *clips[handle]; }
+
+        private:
+            // Indexed by handle, entry 0 is the invalid handle
+            std::vector<std::shared_ptr<const AnimationClip>> clips;
+            std::map<std::string, AnimationClipHandle> names;
+    };
+
+}
+
+#endif // ANIMATIONCLIP_H_
@@ -0,0 +1,97 @@
+#ifndef ANIMATIONSYSTEM_H_
+#define ANIMATIONSYSTEM_H_
+
+#include "AnimationClip.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace spic {
+
+    class AnimationClipLibrary;
+    class Animator;
+    class Sprite;
+
+    /**
+     * @brief The animation state of every Animator in a scene, stored densely and advanced in one pass.
+     * @details Each attribute is its own array indexed by slot, so advancing all animators is a loop over
+     *          contiguous memory without virtual calls or scene graph walks. Only the sprites whose frame
+     *          changed are written back. Removed slots are filled with the last slot, the moved Animator is
+     *          told its new slot.
+     * @sharedapi
+     */
+    class AnimationSystem {
+        public:
+            /**
+             * @brief Add an animator.
+             * @param animator The animator, told its slot through Animator::Slot().
+             * @param sprite The sprite the animator changes.
+             * @param clip The clip of the initial state.
+             * @param speed A multiplier for the frame durations of the clip.
+             * @param playing Whether the slot starts playing, see Animator::IsPlaying().
+             * @param looping Whether the slot loops, see Animator::IsLooping().
+             * @return The slot of the animator.
+             * @sharedapi
+             */
+            std::size_t Add(const std::shared_ptr<Animator>& animator, const std::shared_ptr<Sprite>& sprite, AnimationClipHandle clip, float speed,
+                            bool playing, bool looping);
+
+            /**
+             * @brief Remove an animator.
+             * @param slot The slot returned by Add().
+             * @sharedapi
+             */
+            void Remove(std::size_t slot);
+
+            /**
+             * @brief Switch the clip of an animator, restarting at the first frame.
+             * @sharedapi
+             */
+            void Clip(std::size_t slot, AnimationClipHandle clip);
+
+            /**
+             * @brief Start or stop an animator.
+             * @sharedapi
+             */
+            void Playing(std::size_t slot, bool playing, bool looping);
+
+            /**
+             * @brief Advance a range of slots and remember which of them changed frame.
+             * @details Ranges do not share memory, so the engine can split the slots over worker threads.
+             * @param clips The library the clips are stored in.
+             * @param deltaTime The time in seconds since the last frame.
+             * @param first The first slot.
+             * @param count The amount of slots.
+             * @sharedapi
+             */
+            void Advance(const AnimationClipLibrary& clips, double deltaTime, std::size_t first, std::size_t count);
+
+            /**
+             * @brief Set the frame texture on the sprites whose frame changed, called after all ranges are advanced.
+             * @param clips The library the clips are stored in.
+             * @sharedapi
+             */
+            void WriteBack(const AnimationClipLibrary& clips);
+
+            /**
+             * @brief The amount of animators.
+             * @sharedapi
+             */
+            std::size_t Size() const { return clipIds.size(); }
+
+        private:
+            std::vector<AnimationClipHandle> clipIds;
+            std::vector<std::uint32_t> frameIndices;
+            std::vector<float> elapsed;
+            std::vector<float> speeds;
+            std::vector<std::uint8_t> playing;
+            std::vector<std::uint8_t> looping;
+            std::vector<std::uint8_t> changed;
+            std::vector<std::weak_ptr<Sprite>> sprites;
+            std::vector<std::weak_ptr<Animator>> animators;
+    };
+
+}
+
+#endif // ANIMATIONSYSTEM_H_
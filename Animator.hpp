@@ -1,8 +1,10 @@
 #ifndef ANIMATOR_H_
 #define ANIMATOR_H_
 
+#include "AnimationClip.hpp"
 #include "Component.hpp"
 #include "Sprite.hpp"
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -12,12 +14,25 @@ namespace spic {
 
     /**
      * @brief A component which can play animated sequences of sprites.
+     * @details The playback state lives in the AnimationSystem of the scene; the Animator only holds its slot
+     *          there and forwards Play(), Stop() and state changes to it. Play(), Stop() and CurrentState() may be
+     *          called before the animator is registered, e.g. in a Scene constructor: the requested state is kept
+     *          in the Animator and passed to AnimationSystem::Add() as the initial state of its slot.
      * @spicapi
      */
     class Animator : public Component {
     public:
+        /**
+         * @brief The value of Slot() while the animator is not registered in an AnimationSystem.
+         */
+        static constexpr std::size_t NoSlot = static_cast<std::size_t>(-1);
+
         /**
          * @brief Constructor.
+         * @details The textures of the sprites become a clip with 1 / fps per frame, interned in the engine's
+         *          AnimationClipLibrary, and the animator gets a single state named "default". It is advanced by
+         *          the AnimationSystem like any other animator, writing the frames into the Sprite component of
+         *          its game object; the sprites passed here only provide their textures.
          * @param fps The amount of frames the animator will cycle though per second.
          * @param sprites An list of sprites to loop through.
          * @sharedapi
@@ -26,12 +41,21 @@ namespace spic {
 
         /**
          * @brief Constructor.
+         * @details Every state is interned in the engine's AnimationClipLibrary, so animators created from the
+         *          same map share their clips.
          * @param fps The amount of frames the animator will cycle though per second.
          * @param spritesMap map of the states with the respective sprites vector
          * @sharedapi
          */
         Animator(int fps, const std::map <std::string, std::vector<std::string>> &spritesMap);
 
+        /**
+         * @brief Constructor.
+         * @param states map of the states with the respective clip
+         * @sharedapi
+         */
+        explicit Animator(const std::map <std::string, AnimationClipHandle> &states);
+
         /**
          * @brief Start playing the image sequence.
          * @param looping If true, will automatically start again when done.
@@ -46,6 +70,20 @@ namespace spic {
          */
         void Stop();
 
+        /**
+         * @brief Whether playback was requested through Play() and not stopped since
+         * @return true if the animator should be playing
+         * @sharedapi
+         */
+        bool IsPlaying() const;
+
+        /**
+         * @brief Whether the last Play() asked for looping playback
+         * @return true if the animator loops
+         * @sharedapi
+         */
+        bool IsLooping() const;
+
         /**
          * @brief Get the state the animator is currently in
          * @return A string which defines the state the animator is currently in
@@ -61,11 +99,43 @@ namespace spic {
         void CurrentState(const std::string &newState);
 
         /**
-         * @brief Animate the game object according to the sprites in the vector or sprites map
+         * @brief Resolve the name of a state once, so it can be switched to without string lookups
+         * @param state The name of the state
+         * @return The id of the state, or -1 if the animator has no such state
+         * @sharedapi
+         */
+        int StateId(const std::string &state) const;
+
+        /**
+         * @brief Set the state the animator is currently in
+         * @param stateId the id of the state, as returned by StateId
+         * @sharedapi
+         */
+        void CurrentState(int stateId);
+
+        /**
+         * @brief Advance only this animator by Time::DeltaTime() and write its frame back to the sprite
+         * @details The engine already advances every registered animator once per frame through the
+         *          AnimationSystem of the scene, so do not call this for those as well; it is meant for scripts
+         *          that drive an animator by hand, e.g. while the game is paused. Does nothing if Slot() is NoSlot.
          * @sharedapi
          */
         void Animate();
 
+        /**
+         * @brief The slot of this animator in the AnimationSystem of its scene
+         * @return The slot, or NoSlot if the animator is not registered
+         * @sharedapi
+         */
+        std::size_t Slot() const;
+
+        /**
+         * @brief Set the slot of this animator, called by the AnimationSystem when slots are moved
+         * @param newSlot The new slot, or NoSlot when the animator is removed
+         * @sharedapi
+         */
+        void Slot(std::size_t newSlot);
+
         /**
          * @brief Set the direction the sprites will face
          * @sharedapi
@@ -79,35 +149,28 @@ namespace spic {
          */
         int fps;
 
-        std::vector <std::shared_ptr<Sprite>> sprites;
-
-        /**
-         * @brief index of the current sprite in the current state
-         */
-        int spriteIndex;
-
         /**
-         * @brief name of the current state. for example "idle" or "running"
+         * @brief id of the current state, an index into stateNames and stateClips
          */
-        std::string currentState;
+        int currentState;
 
         /**
-         * @brief map of the states with the respective sprites vector
+         * @brief names of the states. for example "idle" or "running"
          */
-        std::map <std::string, std::vector<std::string>> spritesMap;
+        std::vector <std::string> stateNames;
 
         /**
-         * @brief the time that has elapsed since the last frame
+         * @brief the shared clip of every state
          */
-        double elapsedTime;
+        std::vector <AnimationClipHandle> stateClips;
 
         /**
-         * @brief true if the animator is playing
+         * @brief true if Play() was called and Stop() was not called since
          */
         bool isPlaying;
 
         /**
-         * @brief true if the animator is playing
+         * @brief true if the last Play() asked for looping
          */
         bool isLooping;
 
@@ -115,6 +178,11 @@ namespace spic {
          * @brief true if the object is facing right
          */
         bool flipX;
+
+        /**
+         * @brief the slot in the AnimationSystem of the scene
+         */
+        std::size_t slot;
     };
 
 }
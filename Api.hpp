@@ -1,4 +1,5 @@
 #include "Animator.hpp"
+#include "AudioConfig.hpp"
 #include "AudioSource.hpp"
 #include "BehaviourScript.hpp"
 #include "BoxCollider.hpp"
@@ -15,11 +16,15 @@
 #include "IKeyListener.hpp"
 #include "IMouseListener.hpp"
 #include "Input.hpp"
+#include "ParticleEmitter.hpp"
+#include "PhysicsConfig.hpp"
 #include "Point.hpp"
+#include "RenderConfig.hpp"
 #include "RigidBody.hpp"
 #include "Scene.hpp"
 #include "Sprite.hpp"
 #include "Text.hpp"
+#include "Tilemap.hpp"
 #include "Time.hpp"
 #include "Transform.hpp"
 #include "UIObject.hpp"
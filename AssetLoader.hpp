@@ -0,0 +1,136 @@
+#ifndef ASSETLOADER_H_
+#define ASSETLOADER_H_
+
+#include "TextureRegistry.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace spic {
+
+    /**
+     * @brief Enumeration for the different states of an asset
+     * @sharedapi
+     */
+    enum class AssetState {
+        queued,
+        loading,
+        ready,
+        failed
+    };
+
+    /**
+     * @brief Enumeration for the different kinds of assets the loader can decode
+     * @sharedapi
+     */
+    enum class AssetType {
+        texture,
+        font,
+        audio
+    };
+
+    /**
+     * @brief A small integer identifying a font or audio clip requested from the AssetLoader, 0 means no asset.
+     * @details Audio handles are the AudioClipCache handles of the same path: the loader interns the path in
+     *          the engine's AudioClipCache and hands the decoded clip over with AudioClipCache::Store(). Font
+     *          handles are the values used in TextRunCommand::font.
+     * @sharedapi
+     */
+    using AssetHandle = std::uint32_t;
+
+    /**
+     * @brief Decodes images, fonts and audio on worker threads so loading a scene does not block the main thread.
+     * @details Every request returns immediately. Decoded textures are handed to the render thread, which uploads
+     *          a limited amount per frame. Until a texture is uploaded, sprites using it draw
+     *          TextureRegistry::Placeholder() instead.
+     * @sharedapi
+     */
+    class AssetLoader {
+        public:
+            /**
+             * @brief Constructor, starts the worker threads.
+             * @param workers The amount of worker threads.
+             * @sharedapi
+             */
+            explicit AssetLoader(int workers);
+
+            /**
+             * @brief Destructor, finishes the asset being decoded, drops the rest of the queue and joins the workers.
+             */
+            ~AssetLoader();
+
+            AssetLoader(const AssetLoader&) = delete;
+            AssetLoader& operator=(const AssetLoader&) = delete;
+
+            /**
+             * @brief Queue a texture for loading.
+             * @param path The path of the texture.
+             * @return The handle of the texture, usable with Sprite::Texture right away.
+             * @sharedapi
+             */
+            TextureHandle LoadTexture(const std::string& path);
+
+            /**
+             * @brief Queue a font or audio clip for loading.
+             * @param type The kind of asset, AssetType::texture is forwarded to LoadTexture().
+             * @param path The path of the asset.
+             * @param onReady An optional callback, called on the main thread once the asset is ready.
+             * @return The handle of the asset, returned right away; requesting the same path again returns the
+             *         same handle.
+             * @sharedapi
+             */
+            AssetHandle Load(AssetType type, const std::string& path, std::function<void()> onReady = nullptr);
+
+            /**
+             * @brief Get the state of a texture.
+             * @param handle The handle returned by LoadTexture().
+             * @return The current state.
+             * @sharedapi
+             */
+            AssetState State(TextureHandle handle) const;
+
+            /**
+             * @brief Get the state of a font or audio clip.
+             * @param type The kind of asset the handle was returned for.
+             * @param handle The handle returned by Load().
+             * @return The current state.
+             * @sharedapi
+             */
+            AssetState State(AssetType type, AssetHandle handle) const;
+
+            /**
+             * @brief Upload decoded textures, called by the render thread once per frame.
+             * @param maxBytes The maximum amount of texture data to upload this frame, limits upload hitches.
+             * @sharedapi
+             */
+            void ProcessUploads(std::size_t maxBytes);
+
+            /**
+             * @brief Run the onReady callbacks of finished assets, called by the engine on the main thread.
+             * @sharedapi
+             */
+            void DispatchCallbacks();
+
+            /**
+             * @brief The amount of assets waiting to be decoded or uploaded.
+             * @sharedapi
+             */
+            std::size_t QueueDepth() const;
+
+            /**
+             * @brief The average time in milliseconds between requesting an asset and it becoming ready.
+             * @sharedapi
+             */
+            double AverageLatency() const;
+
+        private:
+            class AssetLoaderImpl;
+
+            std::unique_ptr<AssetLoaderImpl> impl;
+    };
+
+}
+
+#endif // ASSETLOADER_H_
@@ -0,0 +1,131 @@
+#ifndef AUDIOCLIPCACHE_H_
+#define AUDIOCLIPCACHE_H_
+
+#include "AudioMixer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief A small integer identifying an interned audio clip path, 0 means no clip.
+     * @sharedapi
+     */
+    using AudioClipHandle = std::uint32_t;
+
+    /**
+     * @brief Shares decoded audio clips between all AudioSources and limits how often a clip plays at once.
+     * @details A clip is decoded once, no matter how many sources reference its path. Playing a clip that
+     *          already started this frame does not take another voice but raises the volume of the existing one,
+     *          and a clip never plays on more voices than its limit; the oldest instance is restarted instead.
+     *          All members are safe to call from any thread, so AssetLoader workers can hand over clips they
+     *          decoded through Store() while the game thread plays others.
+     * @sharedapi
+     */
+    class AudioClipCache {
+        public:
+            static constexpr AudioClipHandle InvalidHandle = 0;
+
+            /**
+             * @brief Constructor.
+             * @param maxInstances The default amount of voices a single clip may play on at the same time.
+             * @sharedapi
+             */
+            explicit AudioClipCache(int maxInstances);
+
+            /**
+             * @brief Destructor.
+             * @sharedapi
+             */
+            ~AudioClipCache();
+
+            /**
+             * @brief Get the handle of a path, creating one on first use. Does not decode the clip.
+             * @param path The path of the clip, as used by AudioSource::AudioClip().
+             * @return The handle of the path.
+             * @sharedapi
+             */
+            AudioClipHandle Intern(const std::string& path);
+
+            /**
+             * @brief Decode clips ahead of time, e.g. the Scene::PreloadAudio() list before Scene::OnActivate().
+             * @param paths The paths of the clips.
+             * @sharedapi
+             */
+            void Preload(const std::vector<std::string>& paths);
+
+            /**
+             * @brief Hand over a clip that was decoded elsewhere, e.g. by an AssetLoader worker.
+             * @details Replaces the decoded audio of the handle, voices still playing the old buffer keep it.
+             * @param handle The handle, see AssetLoader::Load() with AssetType::audio.
+             * @param buffer The decoded audio.
+             * @sharedapi
+             */
+            void Store(AudioClipHandle handle, std::shared_ptr<const AudioBuffer> buffer);
+
+            /**
+             * @brief Get the decoded audio of a clip.
+             * @details A clip that was neither preloaded nor stored is decoded synchronously on the calling thread,
+             *          so the first Play() of such a clip blocks until it is decoded. Preload the clip or load it
+             *          through the AssetLoader to avoid the hitch.
+             * @param handle The handle.
+             * @return The decoded audio, or nullptr if it could not be decoded.
+             * @sharedapi
+             */
+            std::shared_ptr<const AudioBuffer> Get(AudioClipHandle handle);
+
+            /**
+             * @brief Set how many voices a clip may play on at the same time.
+             * @param handle The handle.
+             * @param maxInstances The limit.
+             * @sharedapi
+             */
+            void MaxInstances(AudioClipHandle handle, int maxInstances);
+
+            /**
+             * @brief Play a clip, coalescing retriggers within the same frame and respecting its instance limit.
+             * @param mixer The mixer to play on.
+             * @param handle The handle.
+             * @param volume The volume between 0.0 and 1.0.
+             * @param looping Automatically start over when done.
+             * @param priority The priority of the voice.
+             * @return The voice the clip plays on, or 0 if the clip could not be decoded.
+             * @sharedapi
+             */
+            VoiceId Play(AudioMixer& mixer, AudioClipHandle handle, double volume, bool looping, int priority);
+
+            /**
+             * @brief Start a new frame, called by the engine once per frame.
+             * @details Removes the instances that stopped playing according to AudioMixer::IsPlaying(), so ended
+             *          voices no longer count towards the instance limit of their clip.
+             * @param mixer The mixer the clips are played on.
+             * @sharedapi
+             */
+            void NewFrame(const AudioMixer& mixer);
+
+            /**
+             * @brief Drop the decoded clips that had no playing instance at the last NewFrame().
+             * @details A voice still mixing a dropped clip keeps its buffer alive until it ends, the memory is
+             *          released after that.
+             * @sharedapi
+             */
+            void EvictUnused();
+
+            /**
+             * @brief The memory in bytes used by decoded clips.
+             * @sharedapi
+             */
+            std::size_t MemoryUsage() const;
+
+        private:
+            class AudioClipCacheImpl;
+
+            std::unique_ptr<AudioClipCacheImpl> impl;
+    };
+
+}
+
+#endif // AUDIOCLIPCACHE_H_
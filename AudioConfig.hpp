@@ -0,0 +1,43 @@
+#ifndef AUDIOCONFIG_H_
+#define AUDIOCONFIG_H_
+
+#include <cstddef>
+
+namespace spic {
+
+    /**
+     * @brief A struct representing the audio configuration
+     * @sharedapi
+     */
+    struct AudioConfig {
+
+        /**
+         * @brief The amount of voices that can play at the same time, more sounds steal the least important voice
+         */
+        int voices{32};
+
+        /**
+         * @brief The sample rate of the mixer in Hz
+         */
+        int sampleRate{48000};
+
+        /**
+         * @brief The amount of frames decoded at a time when streaming music
+         */
+        std::size_t streamChunkFrames{16384};
+
+        /**
+         * @brief A boolean flag if the mixed audio should be discarded instead of played, e.g. for headless benchmarks
+         */
+        bool nullOutput{false};
+
+        /**
+         * @brief The default amount of voices a single clip may play on at the same time
+         */
+        int maxInstancesPerClip{4};
+
+    };
+
+}
+
+#endif // AUDIOCONFIG_H_
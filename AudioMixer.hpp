@@ -0,0 +1,181 @@
+#ifndef AUDIOMIXER_H_
+#define AUDIOMIXER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief Decoded audio as interleaved float samples.
+     * @sharedapi
+     */
+    struct AudioBuffer {
+        std::vector<float> samples;
+        int channels;
+        int sampleRate;
+    };
+
+    /**
+     * @brief The device the mixed audio is written to.
+     * @sharedapi
+     */
+    class AudioOutput {
+        public:
+            virtual ~AudioOutput() = default;
+
+            /**
+             * @brief Write a block of mixed, interleaved stereo samples.
+             * @param samples The samples.
+             * @param frames The amount of frames, each frame has a left and right sample.
+             * @sharedapi
+             */
+            virtual void Write(const float* samples, std::size_t frames) = 0;
+    };
+
+    /**
+     * @brief An output that discards the audio, so the mixer can be benchmarked without an audio device.
+     * @sharedapi
+     */
+    class NullAudioOutput : public AudioOutput {
+        public:
+            void Write(const float*, std::size_t frames) override { written += frames; }
+
+            /**
+             * @brief The amount of frames written so far.
+             * @sharedapi
+             */
+            std::size_t Written() const { return written; }
+
+        private:
+            std::size_t written{0};
+    };
+
+    /**
+     * @brief An identifier of a playing voice, 0 means no voice.
+     * @sharedapi
+     */
+    using VoiceId = std::uint32_t;
+
+    /**
+     * @brief Mixes a fixed pool of voices into float buffers on the engine side.
+     * @details When all voices are in use, a new sound takes the voice with the lowest priority, preferring the
+     *          quietest and then the oldest one; if every voice has a higher priority the new sound is dropped.
+     *          Voices are accumulated into the output block with SIMD. Music is not decoded up front but streamed:
+     *          a worker thread decodes chunks of AudioConfig::streamChunkFrames ahead of the mixer.
+     *
+     *          Play(), Stream(), Stop() and Volume() are called on the game thread and only append a command to a
+     *          queue; Mix() runs on the mix thread (the device callback, or the caller of Update()) and applies
+     *          the queued commands at the start of every block. The queue lock is only held to append or to swap
+     *          the queue out, so the mix thread never waits on game code. Every streamed voice owns a ring buffer
+     *          of StreamRingChunks chunks, filled by the streaming thread and drained by the mix thread without
+     *          locking; when the ring runs dry the voice outputs silence instead of blocking.
+     * @sharedapi
+     */
+    class AudioMixer {
+        public:
+            /**
+             * @brief The amount of streamChunkFrames chunks every streamed voice buffers ahead of the mixer.
+             */
+            static constexpr std::size_t StreamRingChunks = 4;
+
+            /**
+             * @brief Constructor.
+             * @param voices The size of the voice pool.
+             * @param sampleRate The sample rate of the output in Hz.
+             * @param streamChunkFrames The amount of frames decoded at a time for streamed audio.
+             * @param output The device to write to, e.g. a NullAudioOutput.
+             * @sharedapi
+             */
+            AudioMixer(int voices, int sampleRate, std::size_t streamChunkFrames, std::unique_ptr<AudioOutput> output);
+
+            /**
+             * @brief Destructor, stops the streaming thread.
+             */
+            ~AudioMixer();
+
+            AudioMixer(const AudioMixer&) = delete;
+            AudioMixer& operator=(const AudioMixer&) = delete;
+
+            /**
+             * @brief Play decoded audio.
+             * @param buffer The audio, shared between all voices playing it.
+             * @param volume The volume between 0.0 and 1.0.
+             * @param looping Automatically start over when done.
+             * @param priority Voices with a higher priority are not stolen by lower ones, see AudioSource::Priority().
+             * @return The id the voice will have. The sound starts with the next mixed block; if no voice can be
+             *         taken by then it is dropped and the id never plays.
+             * @sharedapi
+             */
+            VoiceId Play(const std::shared_ptr<const AudioBuffer>& buffer, double volume, bool looping, int priority);
+
+            /**
+             * @brief Stream and play an audio file, decoding it in chunks on the streaming thread.
+             * @param path The path of the audio file.
+             * @param volume The volume between 0.0 and 1.0.
+             * @param looping Automatically start over when done.
+             * @param priority The priority of the voice.
+             * @return The id the voice will have, see Play().
+             * @sharedapi
+             */
+            VoiceId Stream(const std::string& path, double volume, bool looping, int priority);
+
+            /**
+             * @brief Stop a voice, returning it to the pool.
+             * @param voice The voice.
+             * @sharedapi
+             */
+            void Stop(VoiceId voice);
+
+            /**
+             * @brief Change the volume of a playing voice.
+             * @param voice The voice.
+             * @param volume The volume between 0.0 and 1.0.
+             * @sharedapi
+             */
+            void Volume(VoiceId voice, double volume);
+
+            /**
+             * @brief Mix all playing voices into a block of interleaved stereo samples.
+             * @param samples The output, must hold 2 * frames floats.
+             * @param frames The amount of frames.
+             * @sharedapi
+             */
+            void Mix(float* samples, std::size_t frames);
+
+            /**
+             * @brief Mix a block and write it to the output.
+             * @param frames The amount of frames.
+             * @sharedapi
+             */
+            void Update(std::size_t frames);
+
+            /**
+             * @brief Check if a voice is still alive.
+             * @details Safe to call from any thread. A voice counts as playing from the moment Play() or Stream()
+             *          returned its id until it ended, was stopped or stolen, or was dropped because no voice was
+             *          free; the state is published by the mix thread after every block.
+             * @param voice The voice.
+             * @return True if the voice is queued or playing, false for 0 and for voices that are gone.
+             * @sharedapi
+             */
+            bool IsPlaying(VoiceId voice) const;
+
+            /**
+             * @brief The amount of voices that were playing after the last mixed block.
+             * @sharedapi
+             */
+            int ActiveVoices() const;
+
+        private:
+            class AudioMixerImpl;
+
+            std::unique_ptr<AudioMixerImpl> impl;
+    };
+
+}
+
+#endif // AUDIOMIXER_H_
@@ -1,6 +1,7 @@
 #ifndef AUDIOSOURCE_H_
 #define AUDIOSOURCE_H_
 
+#include "AudioClipCache.hpp"
 #include "Component.hpp"
 #include <string>
 
@@ -24,6 +25,8 @@ namespace spic {
 
             /**
              * @brief Call this method to start playing audio.
+             * @details Sound effects play the shared clip from the engine's AudioClipCache on a voice of the
+             *          AudioMixer, music is streamed.
              * @param looping Automatically start over when done.
              * @spicapi
              */
@@ -56,6 +59,13 @@ namespace spic {
              */
             const std::string& AudioClip() const;
 
+            /**
+             * @brief Get the handle of the audioClip in the engine's AudioClipCache
+             * @return The handle, interned when the AudioSource was constructed
+             * @sharedapi
+             */
+            AudioClipHandle AudioClipId() const;
+
             /**
              * @brief Get the loop bool of the AudioSource
              * @return The loop check of the AudioSource, which is a bool that shows if the audio should be looped
@@ -70,6 +80,20 @@ namespace spic {
              */
             bool Music() const;
 
+            /**
+             * @brief Get the priority of the AudioSource
+             * @return The priority, when all voices are in use sounds only take voices with a lower priority
+             * @sharedapi
+             */
+            int Priority() const;
+
+            /**
+             * @brief Set the priority of the AudioSource
+             * @param newPriority The new priority, music is usually given the highest priority
+             * @sharedapi
+             */
+            void Priority(int newPriority);
+
         private:
             /**
              * @brief Path to a locally stored audio file.
@@ -77,6 +101,12 @@ namespace spic {
              */
             std::string audioClip;
 
+            /**
+             * @brief Handle of audioClip in the engine's AudioClipCache.
+             * @sharedapi
+             */
+            AudioClipHandle audioClipId;
+
             /**
              * @brief When true, the component will start playing automatically.
              * @spicapi
@@ -100,6 +130,12 @@ namespace spic {
              * @spicapi
              */
             bool music;
+
+            /**
+             * @brief Priority of the voice used to play this source, higher is more important.
+             * @sharedapi
+             */
+            int priority;
     };
 
 }
@@ -3,6 +3,8 @@
 
 #include "GameObject.hpp"
 #include "Color.hpp"
+#include "SpatialGrid.hpp"
+#include "TextureRegistry.hpp"
 
 namespace spic {
 
@@ -10,9 +12,27 @@ namespace spic {
         int x;
         int y;
 
+        /**
+         * @brief The offscreen texture the camera renders into, composited onto the screen at the end of the frame.
+         *        InvalidHandle renders straight to the screen. Made with TextureRegistry::Create(), so it is
+         *        pinned and never evicted while the target is in use.
+         */
+        TextureHandle texture{TextureRegistry::InvalidHandle};
+
         RenderTarget(int x, int y);
     };
 
+    /**
+     * @brief The part of the screen a camera is composited onto, in normalized coordinates (0 to 1).
+     * @sharedapi
+     */
+    struct CameraViewport {
+        double x{0.0};
+        double y{0.0};
+        double width{1.0};
+        double height{1.0};
+    };
+
     /**
      * @brief Class representing a point of view towards the game scene.
      * @spicapi
@@ -37,7 +57,15 @@ namespace spic {
              * @return the current background color.
              * @sharedapi
              */
-            const Color& BackgroundColor() const;
+            Color BackgroundColor() const;
+
+            /**
+             * Get the current background color as stored and drawn.
+             *
+             * @return the packed background color.
+             * @sharedapi
+             */
+            PackedColor PackedBackgroundColor() const { return backgroundColor; }
 
             /**
              * Set a new background color.
@@ -80,19 +108,85 @@ namespace spic {
 
             std::shared_ptr<RenderTarget> Target() const;
 
+            /**
+             * Get the part of the screen this camera is composited onto.
+             *
+             * @return the viewport of the camera.
+             * @sharedapi
+             */
+            const CameraViewport& Viewport() const;
+
+            /**
+             * Set the part of the screen this camera is composited onto, e.g. for split-screen or a minimap.
+             *
+             * @sharedapi
+             */
+            void Viewport(const CameraViewport& newViewport);
+
+            /**
+             * Get the composition order, cameras with a higher depth are drawn on top.
+             *
+             * @return the depth of the camera.
+             * @sharedapi
+             */
+            int Depth() const;
+
+            /**
+             * Set the composition order.
+             *
+             * @sharedapi
+             */
+            void Depth(int newDepth);
+
+            /**
+             * Check if the camera has to render this frame.
+             * A camera with an offscreen target whose view bounds did not change and in whose view nothing moved
+             * keeps its last frame and is only composited again.
+             *
+             * @return true if the camera has to render, false if its target can be reused.
+             * @sharedapi
+             */
+            bool NeedsRender() const;
+
             /**
              * Tell the camera to start rendering the current scene.
+             * Only objects in the cells of the scene's RenderGrid() that intersect ViewBounds() are visited.
+             * Sprites are recorded into the renderer's RenderQueue, which is sorted once and submitted in
+             * texture batches instead of drawing every sprite on its own.
              *
              * @sharedapi
              */
             void Render() const;
 
+            /**
+             * Get the view rectangle of the camera in world coordinates.
+             *
+             * @return the area spanned by the aspect width and height around the camera position.
+             * @sharedapi
+             */
+            Bounds ViewBounds() const;
+
+            /**
+             * Get the amount of objects that intersected the view during the last Render().
+             * Shown next to the FPS counter, see Engine::ToggleFps().
+             *
+             * @return the amount of visible objects.
+             * @sharedapi
+             */
+            std::size_t VisibleCount() const;
+
         private:
-            Color backgroundColor;
+            PackedColor backgroundColor;
             double aspectWidth;
             double aspectHeight;
 
             std::shared_ptr<RenderTarget> renderTarget;
+
+            mutable std::size_t visibleCount;
+
+            CameraViewport viewport;
+            int depth;
+            mutable Bounds lastViewBounds;
     };
 
 }
@@ -0,0 +1,43 @@
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+namespace spic {
+
+    /**
+     * @brief The source of time for the game loop, replaceable to make runs reproducible.
+     * @sharedapi
+     */
+    class Clock {
+        public:
+            virtual ~Clock() = default;
+
+            /**
+             * @brief The current time in seconds, called once at the start of every frame.
+             * @sharedapi
+             */
+            virtual double Now() = 0;
+    };
+
+    /**
+     * @brief A clock that advances a fixed step every frame, regardless of how long the frame took.
+     * @sharedapi
+     */
+    class FixedStepClock : public Clock {
+        public:
+            /**
+             * @brief Constructor.
+             * @param step The time in seconds between two frames.
+             * @sharedapi
+             */
+            explicit FixedStepClock(double step) : step{step}, frames{0} {}
+
+            double Now() override { return step * static_cast<double>(frames++); }
+
+        private:
+            double step;
+            unsigned long long frames;
+    };
+
+}
+
+#endif // CLOCK_H_
@@ -2,19 +2,32 @@
 
 using namespace spic;
 
-Color Color::_white{1.0, 1.0, 1.0, 1.0};
-Color Color::_red{1.0, 0.0, 0.0, 1.0};
-Color Color::_green{0.0, 1.0, 0.0, 1.0};
-Color Color::_blue{0.0, 0.0, 1.0, 1.0};
-Color Color::_cyan{0.0, 1.0, 1.0, 1.0};
-Color Color::_magenta{1.0, 0.0, 1.0, 1.0};
-Color Color::_yellow{1.0, 1.0, 0.0, 1.0};
-Color Color::_black{0.0, 0.0, 0.0, 1.0};
-Color Color::_purple{0.5, 0.0, 0.5, 1.0};
-Color Color::_lime{0.75, 1.0, 0.0, 1.0};
-Color Color::_orange{1.0, 0.6, 0.0, 1.0};
-Color Color::_transparent{0.0, 0.0, 0.0, 0.0};
-// ... more standard colors here
+// The conversion loops below have no dependencies between iterations and work on plain arrays, so the compiler
+// vectorizes them for the target instruction set.
 
-Color::Color(double red, double green, double blue, double alpha)
-        : r{red}, g{green}, b{blue}, a{alpha} {}
\ No newline at end of file
+void spic::PackColors(const Color* colors, PackedColor* packed, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        packed[i] = colors[i].Packed();
+    }
+}
+
+void spic::UnpackColors(const PackedColor* packed, float* rgba, std::size_t count) {
+    constexpr float scale = 1.0f / 255.0f;
+    for (std::size_t i = 0; i < count; ++i) {
+        rgba[i * 4 + 0] = packed[i].r * scale;
+        rgba[i * 4 + 1] = packed[i].g * scale;
+        rgba[i * 4 + 2] = packed[i].b * scale;
+        rgba[i * 4 + 3] = packed[i].a * scale;
+    }
+}
+
+void spic::LerpColors(const PackedColor* from, const PackedColor* to, const float* t, PackedColor* result, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        // Fixed point weight between 0 and 256
+        const int weight = static_cast<int>((t[i] < 0.0f ? 0.0f : (t[i] > 1.0f ? 1.0f : t[i])) * 256.0f);
+        const auto lerp = [weight](std::uint8_t a, std::uint8_t b) {
+            return static_cast<std::uint8_t>(a + (((b - a) * weight) >> 8));
+        };
+        result[i] = {lerp(from[i].r, to[i].r), lerp(from[i].g, to[i].g), lerp(from[i].b, to[i].b), lerp(from[i].a, to[i].a)};
+    }
+}
@@ -1,8 +1,30 @@
 #ifndef COLOR_H_
 #define COLOR_H_
 
+#include <cstddef>
+#include <cstdint>
+
 namespace spic {
 
+    /**
+     * @brief A color packed into four bytes (RGBA8), the format the renderer and particles work with.
+     * @sharedapi
+     */
+    struct PackedColor {
+        std::uint8_t r;
+        std::uint8_t g;
+        std::uint8_t b;
+        std::uint8_t a;
+
+        /**
+         * @brief The color as a single RGBA8 value, red in the most significant byte.
+         * @sharedapi
+         */
+        constexpr std::uint32_t Value() const {
+            return (std::uint32_t{r} << 24) | (std::uint32_t{g} << 16) | (std::uint32_t{b} << 8) | std::uint32_t{a};
+        }
+    };
+
     /**
      * @brief Color represents a red-green-blue color with alpha.
      * @spicapi
@@ -16,7 +38,8 @@ namespace spic {
              * @param blue The blue component, 0 ≤ b ≤ 1.
              * @sharedapi
              */
-            Color(double red, double green, double blue);
+            constexpr Color(double red, double green, double blue)
+                    : r{red}, g{green}, b{blue}, a{1.0} {}
             
             /**
              * @brief Constructor, accepting an rgb value and an alpha (transparency).
@@ -26,63 +49,72 @@ namespace spic {
              * @param alpha The transparency component, 0 ≤ alpha ≤ 1.
              * @spicapi
              */
-            Color(double red, double green, double blue, double alpha);
+            constexpr Color(double red, double green, double blue, double alpha)
+                    : r{red}, g{green}, b{blue}, a{alpha} {}
+
+            /**
+             * @brief Constructor, accepting a packed color.
+             * @param packed The packed color.
+             * @sharedapi
+             */
+            constexpr Color(const PackedColor& packed)
+                    : r{packed.r / 255.0}, g{packed.g / 255.0}, b{packed.b / 255.0}, a{packed.a / 255.0} {}
 
             /**
              * @brief One of the standard colors (read-only): white.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& white() { return _white; }
+            static constexpr const Color& white() { return _white; }
 
             /**
              * @brief One of the standard colors (read-only): red.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& red() { return _red; }
+            static constexpr const Color& red() { return _red; }
 
             /**
              * @brief One of the standard colors (read-only): green.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& green() { return _green; }
+            static constexpr const Color& green() { return _green; }
 
             /**
              * @brief One of the standard colors (read-only): blue.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& blue() { return _blue; }
+            static constexpr const Color& blue() { return _blue; }
 
             /**
              * @brief One of the standard colors (read-only): cyan.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& cyan() { return _cyan; }
+            static constexpr const Color& cyan() { return _cyan; }
 
             /**
              * @brief One of the standard colors (read-only): magenta.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& magenta() { return _magenta; }
+            static constexpr const Color& magenta() { return _magenta; }
 
             /**
              * @brief One of the standard colors (read-only): yellow.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& yellow() { return _yellow; }
+            static constexpr const Color& yellow() { return _yellow; }
 
             /**
              * @brief One of the standard colors (read-only): black.
              * @return A reference to a statically allocated Color instance.
              * @spicapi
              */
-            static const Color& black() { return _black; }
+            static constexpr const Color& black() { return _black; }
 
             /**
              * @brief One of the standard colors (read-only): purple.
@@ -160,27 +192,83 @@ namespace spic {
              */
             double A() const;
 
+            /**
+             * @brief The color packed into four bytes, components are clamped to [0, 1] and rounded.
+             * @return The packed color.
+             * @sharedapi
+             */
+            constexpr PackedColor Packed() const {
+                return {ToByte(r), ToByte(g), ToByte(b), ToByte(a)};
+            }
+
         private:
+            static constexpr std::uint8_t ToByte(double component) {
+                return static_cast<std::uint8_t>((component < 0.0 ? 0.0 : (component > 1.0 ? 1.0 : component)) * 255.0 + 0.5);
+            }
+
             double r;
             double g;
             double b;
             double a;
 
-            static Color _white;
-            static Color _red;
-            static Color _green;
-            static Color _blue;
-            static Color _cyan;
-            static Color _magenta;
-            static Color _yellow;
-            static Color _black;
-            static Color _purple;
-            static Color _lime;
-            static Color _orange;
-            static Color _transparent;
+            static const Color _white;
+            static const Color _red;
+            static const Color _green;
+            static const Color _blue;
+            static const Color _cyan;
+            static const Color _magenta;
+            static const Color _yellow;
+            static const Color _black;
+            static const Color _purple;
+            static const Color _lime;
+            static const Color _orange;
+            static const Color _transparent;
             // ... more standard color here
     };
 
+    inline constexpr Color Color::_white{1.0, 1.0, 1.0, 1.0};
+    inline constexpr Color Color::_red{1.0, 0.0, 0.0, 1.0};
+    inline constexpr Color Color::_green{0.0, 1.0, 0.0, 1.0};
+    inline constexpr Color Color::_blue{0.0, 0.0, 1.0, 1.0};
+    inline constexpr Color Color::_cyan{0.0, 1.0, 1.0, 1.0};
+    inline constexpr Color Color::_magenta{1.0, 0.0, 1.0, 1.0};
+    inline constexpr Color Color::_yellow{1.0, 1.0, 0.0, 1.0};
+    inline constexpr Color Color::_black{0.0, 0.0, 0.0, 1.0};
+    inline constexpr Color Color::_purple{0.5, 0.0, 0.5, 1.0};
+    inline constexpr Color Color::_lime{0.75, 1.0, 0.0, 1.0};
+    inline constexpr Color Color::_orange{1.0, 0.6, 0.0, 1.0};
+    inline constexpr Color Color::_transparent{0.0, 0.0, 0.0, 0.0};
+    // ... more standard colors here
+
+    /**
+     * @brief Pack a range of colors.
+     * @param colors The colors to pack.
+     * @param packed The output, must hold count colors.
+     * @param count The amount of colors.
+     * @sharedapi
+     */
+    void PackColors(const Color* colors, PackedColor* packed, std::size_t count);
+
+    /**
+     * @brief Convert a range of packed colors to float4 (r, g, b, a between 0 and 1).
+     * @param packed The packed colors.
+     * @param rgba The output, must hold 4 * count floats.
+     * @param count The amount of colors.
+     * @sharedapi
+     */
+    void UnpackColors(const PackedColor* packed, float* rgba, std::size_t count);
+
+    /**
+     * @brief Interpolate a range of packed colors, e.g. for color over lifetime of particles.
+     * @param from The colors at t = 0.
+     * @param to The colors at t = 1.
+     * @param t The interpolation factor per color, clamped to [0, 1].
+     * @param result The output, must hold count colors.
+     * @param count The amount of colors.
+     * @sharedapi
+     */
+    void LerpColors(const PackedColor* from, const PackedColor* to, const float* t, PackedColor* result, std::size_t count);
+
 }
 
 #endif // COLOR_H_
@@ -5,6 +5,16 @@
 #include "Color.hpp"
 #include <string>
 
+// Default of Debug::DrawEnabled, define SPIC_DEBUG_DRAW as 1 or 0 to override. Only affects the code including
+// this header, the draw functions themselves are always part of the engine library
+#ifndef SPIC_DEBUG_DRAW
+#ifdef NDEBUG
+#define SPIC_DEBUG_DRAW 0
+#else
+#define SPIC_DEBUG_DRAW 1
+#endif
+#endif
+
 namespace spic {
 
     /**
@@ -13,14 +23,57 @@ namespace spic {
      */
     namespace Debug {
 
+        /**
+         * @brief True if debug drawing is compiled in for the including code, false by default under NDEBUG.
+         * @details Guard draw calls with it to remove them, and the work computing their arguments, from release
+         *          builds: if constexpr (spic::Debug::DrawEnabled) { spic::Debug::DrawLine(a, b); }
+         *          The functions below are declared and exported either way, so a game and the engine may be
+         *          built with different settings.
+         * @sharedapi
+         */
+        inline constexpr bool DrawEnabled = SPIC_DEBUG_DRAW != 0;
+
         /**
          * @brief Draws a colored line between specified start and end points.
+         * @details The line is recorded in the engine's DebugDrawBuffer and drawn together with all other
+         *          debug lines of the frame.
          * @param start The starting point.
          * @param end The end point.
          * @param color The line color, defaults to white.
+         * @param duration The time in seconds the line stays visible, defaults to this frame only.
          * @spicapi
          */
-        void DrawLine(const Point& start, const Point& end, const Color& color = Color::white());
+        void DrawLine(const Point& start, const Point& end, const Color& color = Color::white(), double duration = 0.0);
+
+        /**
+         * @brief Draws the outline of a rectangle.
+         * @param topLeft The top left corner.
+         * @param bottomRight The bottom right corner.
+         * @param color The outline color, defaults to white.
+         * @param duration The time in seconds the rectangle stays visible, defaults to this frame only.
+         * @sharedapi
+         */
+        void DrawRect(const Point& topLeft, const Point& bottomRight, const Color& color = Color::white(), double duration = 0.0);
+
+        /**
+         * @brief Draws the outline of a circle.
+         * @param center The center of the circle.
+         * @param radius The radius of the circle.
+         * @param color The outline color, defaults to white.
+         * @param duration The time in seconds the circle stays visible, defaults to this frame only.
+         * @sharedapi
+         */
+        void DrawCircle(const Point& center, double radius, const Color& color = Color::white(), double duration = 0.0);
+
+        /**
+         * @brief Draws a piece of text in world coordinates.
+         * @param position The top left of the text.
+         * @param text The text.
+         * @param color The text color, defaults to white.
+         * @param duration The time in seconds the text stays visible, defaults to this frame only.
+         * @sharedapi
+         */
+        void DrawText(const Point& position, const std::string& text, const Color& color = Color::white(), double duration = 0.0);
 
         /**
          * @brief Logs a message to the Console.
@@ -0,0 +1,132 @@
+#ifndef DEBUGDRAWBUFFER_H_
+#define DEBUGDRAWBUFFER_H_
+
+#include "Color.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief A vertex of a debug primitive in world coordinates.
+     * @sharedapi
+     */
+    struct DebugVertex {
+        float x;
+        float y;
+        PackedColor color;
+    };
+
+    /**
+     * @brief A piece of debug text, its characters live in DebugDrawBuffer::textData.
+     * @sharedapi
+     */
+    struct DebugTextEntry {
+        float x;
+        float y;
+        PackedColor color;
+        std::uint32_t textOffset;
+        std::uint32_t textLength;
+    };
+
+    /**
+     * @brief Collects the debug primitives of a frame, so each primitive type is flushed in one draw call.
+     * @details Lines, boxes and circles are all stored as line list vertices: a box adds four lines and a circle
+     *          a fixed amount of segments. Primitives with a duration are kept in a separate persistent list and
+     *          copied into the frame until they expire.
+     * @sharedapi
+     */
+    class DebugDrawBuffer {
+        public:
+            /**
+             * @brief Add a line.
+             * @param start The start vertex.
+             * @param end The end vertex.
+             * @param duration The time in seconds the line stays visible, 0 for this frame only.
+             * @sharedapi
+             */
+            void Line(const DebugVertex& start, const DebugVertex& end, double duration);
+
+            /**
+             * @brief Add the outline of an axis aligned box.
+             * @param minX The left side.
+             * @param minY The top side.
+             * @param maxX The right side.
+             * @param maxY The bottom side.
+             * @param color The color.
+             * @param duration The time in seconds the box stays visible, 0 for this frame only.
+             * @sharedapi
+             */
+            void Box(float minX, float minY, float maxX, float maxY, PackedColor color, double duration);
+
+            /**
+             * @brief Add the outline of a circle.
+             * @param x The x coordinate of the center.
+             * @param y The y coordinate of the center.
+             * @param radius The radius.
+             * @param color The color.
+             * @param duration The time in seconds the circle stays visible, 0 for this frame only.
+             * @sharedapi
+             */
+            void Circle(float x, float y, float radius, PackedColor color, double duration);
+
+            /**
+             * @brief Add a piece of text.
+             * @param x The x coordinate of the top left.
+             * @param y The y coordinate of the top left.
+             * @param text The text.
+             * @param color The color.
+             * @param duration The time in seconds the text stays visible, 0 for this frame only.
+             * @sharedapi
+             */
+            void Text(float x, float y, const std::string& text, PackedColor color, double duration);
+
+            /**
+             * @brief Start a new frame: drop the primitives of the last frame and age the persistent ones.
+             * @param deltaTime The time in seconds since the last frame.
+             * @sharedapi
+             */
+            void NewFrame(double deltaTime);
+
+            /**
+             * @brief The line list vertices of this frame, two per line.
+             * @sharedapi
+             */
+            const std::vector<DebugVertex>& Lines() const { return lines; }
+
+            /**
+             * @brief The text entries of this frame.
+             * @sharedapi
+             */
+            const std::vector<DebugTextEntry>& Texts() const { return texts; }
+
+            /**
+             * @brief The characters of the text entries.
+             * @sharedapi
+             */
+            const std::vector<char>& TextData() const { return textData; }
+
+        private:
+            struct PersistentLine {
+                DebugVertex start;
+                DebugVertex end;
+                double remaining;
+            };
+
+            struct PersistentText {
+                DebugTextEntry entry;
+                std::string text;
+                double remaining;
+            };
+
+            std::vector<DebugVertex> lines;
+            std::vector<DebugTextEntry> texts;
+            std::vector<char> textData;
+            std::vector<PersistentLine> persistentLines;
+            std::vector<PersistentText> persistentTexts;
+    };
+
+}
+
+#endif // DEBUGDRAWBUFFER_H_
@@ -6,12 +6,35 @@
 #include "PhysicsManager.hpp"
 #include "Scene.hpp"
 #include <AudioManager.hpp>
+#include <functional>
 #include <memory>
 #include <stack>
 
 namespace spic {
 
+    class AnimationClipLibrary;
+    class AssetLoader;
+    class AudioClipCache;
+    class AudioMixer;
+    class Clock;
+    class DebugDrawBuffer;
+    struct FrameProfile;
+    class GlyphCache;
     class Renderer;
+    class RenderBackend;
+    class RenderThread;
+    class TextureRegistry;
+
+    /**
+     * @brief Frame pacing statistics of the simulation and render threads, in milliseconds.
+     * @sharedapi
+     */
+    struct FramePacingStats {
+        double simulationTime{0.0}; // Scripts, physics, animators and recording render commands
+        double simulationWait{0.0}; // Time the main thread waited for a free command buffer
+        double renderTime{0.0}; // Rasterizing and presenting a command buffer
+        double renderWait{0.0}; // Time the render thread waited for a recorded command buffer
+    };
 
     namespace Input {
         class InputHandler;
@@ -32,18 +55,41 @@ namespace spic {
 
         std::stack<std::shared_ptr<Scene>> scenes;
         std::unique_ptr<spic::Renderer> renderer;
+        std::unique_ptr<spic::RenderThread> renderThread;
+        std::unique_ptr<spic::RenderBackend> renderBackend;
         std::unique_ptr<spic::Input::InputHandler> inputHandler;
         std::unique_ptr<spic::EventBus> eventBus;
         std::unique_ptr<spic::PhysicsManager> physicsManager;
         std::unique_ptr<spic::AudioManager> audioManager;
+        std::unique_ptr<spic::AudioMixer> audioMixer;
+        std::unique_ptr<spic::AudioClipCache> audioClipCache;
+        std::unique_ptr<spic::TextureRegistry> textureRegistry;
+        std::unique_ptr<spic::AnimationClipLibrary> animationClips;
+        std::unique_ptr<spic::AssetLoader> assetLoader;
+        std::unique_ptr<spic::GlyphCache> glyphCache;
+        std::unique_ptr<spic::DebugDrawBuffer> debugDrawBuffer;
 
         bool isRunning;
         int fps;
         bool showFps;
         bool showColliders;
+        FramePacingStats framePacing;
+        std::unique_ptr<spic::Clock> clock;
+        std::function<void(const spic::FrameProfile&)> frameProfiler;
 
         void UpdateBehaviourScripts() const;
+
+        /**
+         * Advance the AnimationSystem of the active scene in one pass, split over worker threads for large
+         * scenes, and write back only the sprites whose frame changed.
+         */
         void UpdateAnimators() const;
+
+        /**
+         * Record the active scene into a free RenderCommandBuffer and hand it to the render thread.
+         * Does not wait for presentation, unless all RenderConfig::framesInFlight buffers are in use.
+         * Without RenderConfig::renderThread the buffer is rasterized and presented on the calling thread.
+         */
         void Render();
 
     public:
@@ -56,6 +102,9 @@ namespace spic {
         /**
          * @brief Initialize the engine with the given configuration.
          * @param config The engine configuration struct.
+         * @throws std::out_of_range If config.render.renderThread is enabled and config.render.framesInFlight is
+         *         outside [RenderConfig::MinFramesInFlight, RenderConfig::MaxFramesInFlight]. Without the render
+         *         thread the field is ignored and not validated.
          */
         void Init(const spic::EngineConfig& config);
 
@@ -65,8 +114,35 @@ namespace spic {
          */
         spic::EngineConfig& Config();
 
-        void Start();
+        /**
+         * @brief Run the game loop.
+         * @param maxFrames Stop after this amount of frames, 0 runs until Shutdown().
+         */
+        void Start(std::size_t maxFrames = 0);
+
+        /**
+         * @brief Replace the clock of the game loop, e.g. with a FixedStepClock for reproducible runs.
+         * @param newClock The new clock.
+         * @sharedapi
+         */
+        void Clock(std::unique_ptr<spic::Clock> newClock);
+
+        /**
+         * @brief Register a function called at the end of every frame with the timings of its stages.
+         * @param profiler The function, or nullptr to stop profiling.
+         * @sharedapi
+         */
+        void FrameProfiler(std::function<void(const spic::FrameProfile&)> profiler);
+
+        /**
+         * Push a scene on top of the stack and activate it.
+         * Textures, fonts and audio of the scene are loaded by the AssetLoader in the background, sprites draw a
+         * placeholder until their texture is ready. Clips in Scene::PreloadAudio() are decoded before
+         * Scene::OnActivate() is called.
+         * @param scene The scene to activate.
+         */
         void PushScene(const std::shared_ptr<Scene>& scene);
+
         std::shared_ptr<Scene> PeekScene() const;
         void PopScene();
         void Shutdown();
@@ -85,6 +161,41 @@ namespace spic {
          */
         const std::unique_ptr<spic::PhysicsManager>& PhysicsManager() const;
 
+        /**
+         * Retrieve the TextureRegistry that interns texture paths and caches the loaded textures.
+         * @return The texture registry.
+         * @sharedapi
+         */
+        spic::TextureRegistry& TextureRegistry() const;
+
+        /**
+         * Retrieve the AnimationClipLibrary in which animation clips are registered.
+         * @return The animation clip library.
+         * @sharedapi
+         */
+        spic::AnimationClipLibrary& AnimationClips() const;
+
+        /**
+         * Retrieve the AssetLoader with which to load assets in the background.
+         * @return The asset loader.
+         * @sharedapi
+         */
+        spic::AssetLoader& AssetLoader() const;
+
+        /**
+         * @note May NOT be used in the game, but since there is no package private it is public here.
+         * @return The glyph atlases shared by all Text objects.
+         * @sharedapi
+         */
+        spic::GlyphCache& GlyphCache() const;
+
+        /**
+         * @note May NOT be used in the game, but since there is no package private it is public here.
+         * @return The buffer the Debug::Draw functions and the collider overlay record into.
+         * @sharedapi
+         */
+        spic::DebugDrawBuffer& DebugDrawBuffer() const;
+
         /**
          * @note May NOT be used in the game, but since there is no package private it is public here.
          * @return The renderer.
@@ -92,6 +203,20 @@ namespace spic {
          */
         const std::unique_ptr<spic::Renderer>& Renderer() const;
 
+        /**
+         * @note May NOT be used in the game, but since there is no package private it is public here.
+         * @return The backend selected with RenderConfig::backend.
+         * @sharedapi
+         */
+        const std::unique_ptr<spic::RenderBackend>& RenderBackend() const;
+
+        /**
+         * Retrieve the frame pacing of the last frame for both the simulation and the render thread.
+         * @return The frame pacing statistics.
+         * @sharedapi
+         */
+        const spic::FramePacingStats& FramePacing() const;
+
         /**
          * @note May NOT be used in the game, but since there is no package private it is public here.
          * @return The input handler.
@@ -106,6 +231,20 @@ namespace spic {
          */
         const std::unique_ptr<spic::AudioManager>& AudioManager() const;
 
+        /**
+         * @note May NOT be used in the game, but since there is no package private it is public here.
+         * @return The mixer the audio manager plays through.
+         * @sharedapi
+         */
+        spic::AudioMixer& AudioMixer() const;
+
+        /**
+         * Retrieve the cache of decoded audio clips, e.g. to report its memory usage.
+         * @return The audio clip cache.
+         * @sharedapi
+         */
+        spic::AudioClipCache& AudioClipCache() const;
+
         /**
          * Transition to a new scene with a transition scene in between.
          *
@@ -124,7 +263,18 @@ namespace spic {
             PushScene(transition);
         }
 
+        /**
+         * Toggle the FPS overlay, which also shows the amount of visible objects of the active camera.
+         * @sharedapi
+         */
         void ToggleFps();
+
+        /**
+         * Toggle the collider overlay. Colliders are recorded as boxes and circles in the DebugDrawBuffer, so the
+         * overlay is one draw call regardless of the amount of colliders. Does nothing when the engine is built
+         * with SPIC_DEBUG_DRAW set to 0.
+         * @sharedapi
+         */
         void ToggleColliders();
     };
 }
@@ -1,6 +1,9 @@
 #ifndef ENGINECONFIG_H_
 #define ENGINECONFIG_H_
 
+#include "AudioConfig.hpp"
+#include "PhysicsConfig.hpp"
+#include "RenderConfig.hpp"
 #include "WindowConfig.hpp"
 
 namespace spic {
@@ -16,6 +19,26 @@ namespace spic {
          */
         WindowConfig window;
 
+        /**
+         * @brief The sub config for the physics world.
+         */
+        PhysicsConfig physics;
+
+        /**
+         * @brief The sub config for rendering.
+         */
+        RenderConfig render;
+
+        /**
+         * @brief The sub config for the audio mixer.
+         */
+        AudioConfig audio;
+
+        /**
+         * @brief The amount of worker threads decoding assets in the background.
+         */
+        int assetWorkers{2};
+
     };
 
 }
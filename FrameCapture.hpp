@@ -0,0 +1,112 @@
+#ifndef FRAMECAPTURE_H_
+#define FRAMECAPTURE_H_
+
+#include "Input.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace spic {
+
+    class Scene;
+
+    /**
+     * @brief The time in milliseconds spent in each stage of a frame, and the hash of the rendered frame.
+     * @sharedapi
+     */
+    struct FrameProfile {
+        std::uint64_t frame{0};
+        double scripts{0.0};
+        double physics{0.0};
+        double animators{0.0};
+        double render{0.0};
+        std::uint64_t framebufferHash{0};
+    };
+
+    /**
+     * @brief The result of comparing a capture with a baseline.
+     * @sharedapi
+     */
+    struct CaptureComparison {
+        bool passed{true};
+
+        /**
+         * @brief The first frame whose framebuffer hash differs, or -1 if all frames match.
+         */
+        long long firstMismatchFrame{-1};
+
+        /**
+         * @brief The stage with the largest slowdown and how many times slower it got compared to the baseline.
+         */
+        std::string slowestStage;
+        double slowdown{1.0};
+    };
+
+    /**
+     * @brief Runs a scene headless for a fixed amount of frames with scripted input and records a FrameProfile per frame.
+     * @details The run uses a FixedStepClock and the software render backend, so the same scene and input always
+     *          produce the same framebuffer hashes. Comparing against a saved baseline catches both changed
+     *          output and slower stages.
+     * @sharedapi
+     */
+    class FrameCapture {
+        public:
+            /**
+             * @brief Constructor.
+             * @param frames The amount of frames to run.
+             * @param step The fixed time step in seconds.
+             * @param script The input to replay, see Input::PlayScript().
+             * @sharedapi
+             */
+            FrameCapture(std::size_t frames, double step, std::vector<Input::InputEvent> script = {});
+
+            /**
+             * @brief Run the scene and record its profiles.
+             * @param scene The scene to run, pushed on the engine for the duration of the run.
+             * @return The recorded profiles, one per frame.
+             * @sharedapi
+             */
+            const std::vector<FrameProfile>& Run(const std::shared_ptr<Scene>& scene);
+
+            /**
+             * @brief The profiles recorded by the last Run().
+             * @sharedapi
+             */
+            const std::vector<FrameProfile>& Profiles() const { return profiles; }
+
+            /**
+             * @brief Write the recorded profiles as a baseline.
+             * @param path The path of the baseline file.
+             * @sharedapi
+             */
+            void Save(const std::string& path) const;
+
+            /**
+             * @brief Read a baseline written by Save().
+             * @param path The path of the baseline file.
+             * @exception A std::runtime_error is thrown when the file can not be read.
+             * @sharedapi
+             */
+            static std::vector<FrameProfile> Load(const std::string& path);
+
+            /**
+             * @brief Compare the recorded profiles with a baseline.
+             * @param baseline The baseline profiles.
+             * @param tolerance How many times slower the median time of a stage may get, e.g. 1.1 for 10%.
+             * @return The comparison, failed if a hash differs or a stage got slower than the tolerance.
+             * @sharedapi
+             */
+            CaptureComparison Compare(const std::vector<FrameProfile>& baseline, double tolerance) const;
+
+        private:
+            std::size_t frames;
+            double step;
+            std::vector<Input::InputEvent> script;
+            std::vector<FrameProfile> profiles;
+    };
+
+}
+
+#endif // FRAMECAPTURE_H_
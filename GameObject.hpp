@@ -5,6 +5,8 @@
 #include "Debug.hpp"
 #include "Engine.hpp"
 #include "Transform.hpp"
+#include <atomic>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
@@ -443,19 +445,71 @@ namespace spic {
              */
             bool IsActiveInWorld() const;
 
+            /**
+             * @brief Mark this game object and its children as static.
+             * @details The sprites of a static subtree are rendered into the scene's StaticLayerCache instead of
+             *          being drawn every frame, regardless of their sorting layer. A changed Sprite::Version() or
+             *          TransformVersion() re-renders the tiles the sprite overlaps.
+             * @param isStatic Desired value.
+             * @sharedapi
+             */
+            void Static(bool isStatic);
+
+            /**
+             * @brief Returns whether this game object or one of its parents is marked static.
+             * @return true if static, false if not.
+             * @sharedapi
+             */
+            bool Static() const;
+
             /**
              * @brief Returns the transform of this GameObject
+             * @details Reading through this reference is free. Writing through it is not tracked: the physics world
+             *          and the render grid only see edits that change TransformVersion(), so call
+             *          MarkTransformChanged() after editing, or use the Transform(const spic::Transform&) setter
+             *          or ForcePositionTo() instead.
              * @return A reference to the transform
              * @sharedapi
              */
-            spic::Transform& Transform();
+            spic::Transform& Transform() { return transform; }
 
             /**
              * @brief Returns a const reference to the transform of this GameObject
              * @return A const reference to the transform
              * @sharedapi
              */
-            const spic::Transform& Transform() const;
+            const spic::Transform& Transform() const { return transform; }
+
+            /**
+             * @brief Replace the transform of this GameObject and stamp a new TransformVersion()
+             * @param newTransform The desired transform
+             * @sharedapi
+             */
+            void Transform(const spic::Transform& newTransform) {
+                transform = newTransform;
+                MarkTransformChanged();
+            }
+
+            /**
+             * @brief Report an edit made through the reference returned by Transform()
+             * @details Stamps a new TransformVersion(), so the body is pushed to the physics world and the render
+             *          bounds are updated on the next frame. Bodies that were not edited keep their contacts and
+             *          sleeping state.
+             * @sharedapi
+             */
+            void MarkTransformChanged() { transformVersion = NextTransformVersion(); }
+
+            /**
+             * @brief Returns a stamp that changes every time the transform is edited through a tracked path
+             * @details Set by the Transform(const spic::Transform&) setter, MarkTransformChanged(),
+             *          ForcePositionTo() and Parent() to the next value of a counter shared by all game objects,
+             *          so a later edit anywhere always has a larger stamp. Reading the transform never changes it.
+             *          Systems that mirror the transform (physics bodies, render bounds) store the version they
+             *          last saw and only synchronize game objects whose version differs.
+             * @return The current version of the transform
+             * @sharedapi
+             */
+            std::uint64_t TransformVersion() const { return transformVersion; }
 
             /**
              * The parent of this GameObject.
@@ -466,6 +520,7 @@ namespace spic {
 
             /**
              * The parent of this GameObject.
+             * Stamps a new TransformVersion(), since the world transform now follows another parent.
              * @param parent A weak pointer to the new parent
              * @sharedapi
              */
@@ -514,11 +569,21 @@ namespace spic {
 
             /**
              * Retrieve the layer of this GameObject.
+             * The physics world filters collisions on this layer, see PhysicsConfig::layerCollisionMasks. Layers
+             * outside 0 to PhysicsConfig::MaxLayers - 1 are not filtered and collide with every layer.
              * @return the layer of this GameObject.
              * @sharedapi
              */
             int Layer() const;
 
+            /**
+             * Retrieve the unique identifier of this GameObject.
+             * Identifiers are handed out in order of creation, which makes them usable as a stable sort key.
+             * @return the identifier of this GameObject.
+             * @sharedapi
+             */
+            int Id() const;
+
             /**
              * Retrieve the relative position of this gameobject in relation to its parent.
              * @return the relative position of this gameobject in relation to its parent.
@@ -526,12 +591,32 @@ namespace spic {
              */
             Point RelativePosition();
 
+            /**
+             * Teleport this gameobject to a new position, overriding the physics simulation.
+             * Stamps a new TransformVersion(), so the body is pushed to the physics world on the next update.
+             * @param point The new position.
+             * @sharedapi
+             */
             void ForcePositionTo(Point point);
 
+            /**
+             * Mark the forced position as applied to the physics world.
+             * @sharedapi
+             */
             void MarkForcedPositionRead();
 
+            /**
+             * Check if a forced position is waiting to be applied to the physics world.
+             * @return true if a forced position is pending, false otherwise.
+             * @sharedapi
+             */
             bool HasForcedPosition() const;
 
+            /**
+             * Retrieve the pending forced position.
+             * @return the pending forced position.
+             * @sharedapi
+             */
             Point ForcedPosition();
 
         private:
@@ -591,6 +676,13 @@ namespace spic {
 
             bool positionForced;
             Point newForcedPosition;
+            bool isStatic;
+            std::uint64_t transformVersion;
+
+            static std::uint64_t NextTransformVersion() {
+                static std::atomic<std::uint64_t> counter{0};
+                return ++counter;
+            }
     };
 
 }
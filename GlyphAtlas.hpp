@@ -0,0 +1,182 @@
+#ifndef GLYPHATLAS_H_
+#define GLYPHATLAS_H_
+
+#include "Color.hpp"
+#include "TextureAtlas.hpp"
+#include "TextureRegistry.hpp"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace spic {
+
+    enum class FontStyle;
+    class GlyphCache;
+
+    /**
+     * @brief A rasterized glyph inside a GlyphAtlas.
+     * @sharedapi
+     */
+    struct Glyph {
+        AtlasRect rect;
+        double u0;
+        double v0;
+        double u1;
+        double v1;
+        double bearingX;
+        double bearingY;
+        double advance;
+    };
+
+    /**
+     * @brief A positioned glyph of a laid out text, relative to the top left of the Text object.
+     * @sharedapi
+     */
+    struct GlyphQuad {
+        double x;
+        double y;
+        double width;
+        double height;
+        double u0;
+        double v0;
+        double u1;
+        double v1;
+    };
+
+    /**
+     * @brief The cached result of laying out the content of a Text object.
+     * @details The quads are converted to SpriteQuadCommands and pushed into the RenderQueue at
+     *          RenderQueue::UiSortingLayer, all of them share the atlas texture so a whole text is one batch.
+     * @sharedapi
+     */
+    struct TextLayout {
+        TextureHandle texture{TextureRegistry::InvalidHandle};
+        std::uint64_t generation{0}; // GlyphCache::Generation() the layout was built at
+        PackedColor color{255, 255, 255, 255};
+        std::vector<GlyphQuad> quads;
+    };
+
+    /**
+     * @brief The glyphs of one font at one size and style, rasterized on demand into a single texture.
+     * @details When a new glyph does not fit anymore the atlas is reset: all glyphs are dropped, the texture is
+     *          cleared and the glyphs are rasterized again on their next use. Every reset increments
+     *          GlyphCache::Generation(), so layouts referring to the old UVs are rebuilt.
+     *          The texture is an offscreen TextureRegistry::Create() texture, owned by the atlas and released
+     *          when the atlas is destroyed, e.g. by GlyphCache::Clear().
+     * @sharedapi
+     */
+    class GlyphAtlas {
+        public:
+            /**
+             * @brief Constructor.
+             * @param cache The cache owning this atlas, notified when the atlas is reset.
+             * @param font The path of the font.
+             * @param size The size the font is rasterized at.
+             * @param style The font style.
+             * @sharedapi
+             */
+            GlyphAtlas(GlyphCache& cache, const std::string& font, int size, FontStyle style);
+
+            /**
+             * @brief Destructor, releases the texture from the registry of the cache.
+             */
+            ~GlyphAtlas();
+
+            GlyphAtlas(const GlyphAtlas&) = delete;
+            GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+            /**
+             * @brief Get a glyph, rasterizing it into the atlas on first use.
+             * @details Resets the atlas first if the glyph does not fit. References returned earlier are
+             *          invalidated by a reset, so copy what is needed before getting the next glyph.
+             * @param codepoint The unicode codepoint.
+             * @return The glyph. A glyph larger than the whole texture gets an empty rect, it only advances.
+             * @sharedapi
+             */
+            const Glyph& Get(char32_t codepoint);
+
+            /**
+             * @brief The texture containing the rasterized glyphs.
+             * @sharedapi
+             */
+            TextureHandle Texture() const { return texture; }
+
+            /**
+             * @brief The distance between two baselines.
+             * @sharedapi
+             */
+            double LineHeight() const { return lineHeight; }
+
+        private:
+            GlyphCache& cache;
+            std::string font;
+            int size;
+            FontStyle style;
+            double lineHeight;
+            TextureHandle texture;
+            SkylinePacker packer;
+            std::unordered_map<char32_t, Glyph> glyphs;
+    };
+
+    /**
+     * @brief Shares one GlyphAtlas per (font, size, style) between all Text objects.
+     * @sharedapi
+     */
+    class GlyphCache {
+        public:
+            /**
+             * @brief Constructor.
+             * @param registry The registry the atlas textures are created in and released from.
+             * @sharedapi
+             */
+            explicit GlyphCache(TextureRegistry& registry);
+
+            /**
+             * @brief The registry owning the atlas textures.
+             * @sharedapi
+             */
+            TextureRegistry& Registry() const { return registry; }
+
+            /**
+             * @brief Get the atlas of a font, creating it on first use.
+             * @param font The path of the font.
+             * @param size The size of the font.
+             * @param style The font style.
+             * @return The shared atlas.
+             * @sharedapi
+             */
+            GlyphAtlas& Atlas(const std::string& font, int size, FontStyle style);
+
+            /**
+             * @brief Remove all atlases, releasing their textures, e.g. when a scene is popped. Increments Generation().
+             * @sharedapi
+             */
+            void Clear();
+
+            /**
+             * @brief A counter that changes whenever glyph UVs or textures held by a TextLayout may have become
+             *        invalid, i.e. after Clear() or after an atlas was reset because it was full.
+             * @details Text::Layout() rebuilds its layout when the generation differs from the one it was built at.
+             * @sharedapi
+             */
+            std::uint64_t Generation() const { return generation; }
+
+            /**
+             * @brief Increment Generation(), called by a GlyphAtlas when it resets.
+             * @sharedapi
+             */
+            void Invalidate() { ++generation; }
+
+        private:
+            TextureRegistry& registry;
+            std::uint64_t generation{1};
+            std::map<std::tuple<std::string, int, FontStyle>, std::unique_ptr<GlyphAtlas>> atlases;
+    };
+
+}
+
+#endif // GLYPHATLAS_H_
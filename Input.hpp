@@ -4,7 +4,9 @@
 #include "Point.hpp"
 #include "IKeyListener.hpp"
 #include "IMouseListener.hpp"
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace spic {
 
@@ -272,6 +274,26 @@ namespace spic {
             RIGHT = 3
         };
 
+        /**
+         * @brief A recorded key or mouse button change, replayed by PlayScript().
+         * @sharedapi
+         */
+        struct InputEvent {
+            std::uint64_t frame;
+            KeyCode key;
+            MouseButton button;
+            bool isMouse;
+            bool pressed;
+            Point mousePosition;
+        };
+
+        /**
+         * @brief Replace device input with a recorded script, events are applied at the start of their frame.
+         * @param events The events, ordered by frame. An empty script restores device input.
+         * @sharedapi
+         */
+        void PlayScript(const std::vector<InputEvent>& events);
+
         /**
          * @brief Is any key or mouse button currently held down? (Read Only)
          * @spicapi
@@ -0,0 +1,169 @@
+#ifndef PARTICLEEMITTER_H_
+#define PARTICLEEMITTER_H_
+
+#include "Color.hpp"
+#include "Component.hpp"
+#include "Point.hpp"
+#include "RenderQueue.hpp"
+#include "TextureRegistry.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief A struct representing the settings of a ParticleEmitter
+     * @sharedapi
+     */
+    struct ParticleSettings {
+        double rate{100.0}; // Particles emitted per second
+        double lifetime{1.0}; // Seconds
+        double speed{100.0};
+        double spread{360.0}; // Degrees around the emitter direction
+        double direction{0.0}; // Degrees
+        Point gravity{0.0, 0.0};
+        double startSize{8.0};
+        double endSize{8.0};
+        PackedColor startColor{255, 255, 255, 255};
+        PackedColor endColor{255, 255, 255, 0};
+        std::size_t maxParticles{10000};
+    };
+
+    /**
+     * @brief A component which emits and simulates many small sprites without a GameObject per particle.
+     * @details Particles are stored as separate float arrays per attribute, so velocity, gravity, color and size
+     *          over lifetime are updated with SIMD over contiguous memory. Dead particles are swapped with the last
+     *          live one, keeping the live particles packed at the front. All particles share one texture and are
+     *          pushed into the RenderQueue as quads at the emitter's sorting layer and order, so an emitter sorts
+     *          against sprites like a sprite would and draws as one batch.
+     * @sharedapi
+     */
+    class ParticleEmitter : public Component {
+        public:
+            /**
+             * @brief Constructor.
+             * @param texture The path of the particle texture.
+             * @param settings The settings of the emitter.
+             * @sharedapi
+             */
+            ParticleEmitter(const std::string& texture, const ParticleSettings& settings);
+
+            /**
+             * @brief Start emitting particles at ParticleSettings::rate.
+             * @sharedapi
+             */
+            void Play();
+
+            /**
+             * @brief Stop emitting particles, live particles finish their lifetime.
+             * @sharedapi
+             */
+            void Stop();
+
+            /**
+             * @brief Emit a burst of particles at once.
+             * @param count The amount of particles.
+             * @sharedapi
+             */
+            void Emit(std::size_t count);
+
+            /**
+             * @brief Emit new particles and advance all live particles.
+             * @param deltaTime The time in seconds since the last update.
+             * @sharedapi
+             */
+            void Update(double deltaTime);
+
+            /**
+             * @brief Advance a range of live particles, without emitting or removing any.
+             * @details Ranges do not share memory, so the engine can split a large emitter over worker threads
+             *          and call Compact() afterwards.
+             * @param deltaTime The time in seconds since the last update.
+             * @param first The index of the first particle.
+             * @param count The amount of particles.
+             * @sharedapi
+             */
+            void Simulate(double deltaTime, std::size_t first, std::size_t count);
+
+            /**
+             * @brief Remove the particles whose lifetime ended.
+             * @sharedapi
+             */
+            void Compact();
+
+            /**
+             * @brief Push a quad for every live particle.
+             * @param queue The render queue of the camera.
+             * @sharedapi
+             */
+            void Record(RenderQueue& queue) const;
+
+            /**
+             * @brief The layer the particles will be sorted on, see Sprite::SortingLayer().
+             * @sharedapi
+             */
+            int SortingLayer() const { return sortingLayer; }
+
+            /**
+             * @brief Set the layer the particles will be sorted on.
+             * @param newSortingLayer The desired value.
+             * @sharedapi
+             */
+            void SortingLayer(int newSortingLayer) { sortingLayer = newSortingLayer; }
+
+            /**
+             * @brief The order of the particles within their sorting layer, see Sprite::OrderInLayer().
+             * @sharedapi
+             */
+            int OrderInLayer() const { return orderInLayer; }
+
+            /**
+             * @brief Set the order of the particles within their sorting layer.
+             * @param newOrderInLayer The desired value.
+             * @sharedapi
+             */
+            void OrderInLayer(int newOrderInLayer) { orderInLayer = newOrderInLayer; }
+
+            /**
+             * @brief The amount of live particles.
+             * @sharedapi
+             */
+            std::size_t Count() const { return count; }
+
+            /**
+             * @brief The settings of the emitter.
+             * @sharedapi
+             */
+            const ParticleSettings& Settings() const { return settings; }
+
+            /**
+             * @brief Change the settings of the emitter.
+             * @details Resizes the particle arrays to the new ParticleSettings::maxParticles; when it shrinks, the
+             *          live particles beyond the new maximum are removed.
+             * @param newSettings The desired settings.
+             * @sharedapi
+             */
+            void Settings(const ParticleSettings& newSettings);
+
+        private:
+            TextureHandle texture;
+            ParticleSettings settings;
+            int sortingLayer{0};
+            int orderInLayer{0};
+            bool isPlaying;
+            double emitAccumulator;
+            std::size_t count;
+
+            std::vector<float> positionX;
+            std::vector<float> positionY;
+            std::vector<float> velocityX;
+            std::vector<float> velocityY;
+            std::vector<float> age;
+            std::vector<float> lifetime;
+    };
+
+}
+
+#endif // PARTICLEEMITTER_H_
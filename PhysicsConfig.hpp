@@ -0,0 +1,109 @@
+#ifndef PHYSICSCONFIG_H_
+#define PHYSICSCONFIG_H_
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+namespace spic {
+
+    /**
+     * @brief A struct representing the physics configuration
+     * @sharedapi
+     */
+    struct PhysicsConfig {
+
+        /**
+         * @brief The amount of layers the collision matrix supports, layers are numbered 0 to MaxLayers - 1.
+         * @details Game objects on a layer outside this range are not filtered: the broadphase gives them a
+         *          full mask, so they collide with every layer.
+         */
+        static constexpr int MaxLayers = 32;
+
+        /**
+         * @brief The layer collision matrix, bit b of entry a is set if layer a collides with layer b.
+         * @details The masks are copied into the broadphase proxies, so pairs whose layers never interact
+         *          are rejected before any contact is generated. Defaults to every layer colliding with every
+         *          other layer.
+         */
+        std::array<std::uint32_t, MaxLayers> layerCollisionMasks{MakeDefaultMasks()};
+
+        /**
+         * @brief A boolean flag if trigger pairs without a BehaviourScript on either game object should be skipped
+         */
+        bool skipUnobservedTriggers{true};
+
+        /**
+         * @brief A boolean flag if the physics world should be bit-reproducible.
+         * @details In deterministic mode the world is always stepped with fixedTimeStep, and bodies and contact
+         *          pairs are processed in order of GameObject::Id() instead of container order. Use it for
+         *          replays and regression runs together with PhysicsManager::Snapshot() and Restore().
+         */
+        bool deterministic{false};
+
+        /**
+         * @brief The step size in seconds used in deterministic mode
+         */
+        double fixedTimeStep{1.0 / 60.0};
+
+        /**
+         * @brief Set if two layers collide with each other.
+         * @param layerA The first layer.
+         * @param layerB The second layer.
+         * @param collide A boolean flag if the layers should collide.
+         * @exception A std::out_of_range is thrown when a layer is outside 0 to MaxLayers - 1.
+         */
+        void LayerCollision(int layerA, int layerB, bool collide) {
+            if (!IsFilteredLayer(layerA) || !IsFilteredLayer(layerB)) {
+                throw std::out_of_range("PhysicsConfig::LayerCollision: layer outside of the collision matrix");
+            }
+
+            if (collide) {
+                layerCollisionMasks[layerA] |= Bit(layerB);
+                layerCollisionMasks[layerB] |= Bit(layerA);
+            } else {
+                layerCollisionMasks[layerA] &= ~Bit(layerB);
+                layerCollisionMasks[layerB] &= ~Bit(layerA);
+            }
+        }
+
+        /**
+         * @brief Get if two layers collide with each other.
+         * @param layerA The first layer.
+         * @param layerB The second layer.
+         * @return True if the layers collide, false if not. Always true if a layer is outside the matrix.
+         */
+        bool LayerCollision(int layerA, int layerB) const {
+            if (!IsFilteredLayer(layerA) || !IsFilteredLayer(layerB)) {
+                return true;
+            }
+
+            return (layerCollisionMasks[layerA] & Bit(layerB)) != 0;
+        }
+
+        /**
+         * @brief Get if a layer is part of the collision matrix.
+         * @param layer The layer.
+         * @return True if the layer is between 0 and MaxLayers - 1.
+         */
+        static constexpr bool IsFilteredLayer(int layer) {
+            return layer >= 0 && layer < MaxLayers;
+        }
+
+    private:
+        static constexpr std::uint32_t Bit(int layer) {
+            return std::uint32_t{1} << layer;
+        }
+
+        static constexpr std::array<std::uint32_t, MaxLayers> MakeDefaultMasks() {
+            std::array<std::uint32_t, MaxLayers> masks{};
+            for (auto& mask : masks) {
+                mask = ~std::uint32_t{0};
+            }
+            return masks;
+        }
+    };
+
+}
+
+#endif // PHYSICSCONFIG_H_
@@ -1,11 +1,26 @@
 #ifndef BANJO_GAME_PHYSICSMANAGER_HPP
 #define BANJO_GAME_PHYSICSMANAGER_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace spic {
     class GameObject;
 
+    /**
+     * @brief Counters describing the physics world after the last update.
+     * @sharedapi
+     */
+    struct PhysicsStats {
+        std::size_t bodies{0};
+        std::size_t awakeBodies{0};
+        std::size_t broadphasePairs{0};
+        std::size_t contacts{0};
+        std::size_t memoryBytes{0};
+    };
+
     class PhysicsManager {
     public:
         PhysicsManager();
@@ -22,6 +37,51 @@ namespace spic {
 
         void DestroyObject(const std::shared_ptr<GameObject>& gameObject);
 
+        /**
+         * Force the transform of a game object to be pushed to its physics body on the next Update().
+         * Edits through the GameObject::Transform() setter, GameObject::MarkTransformChanged() and
+         * GameObject::ForcePositionTo() are detected through GameObject::TransformVersion() and do not need this;
+         * only bodies whose version changed since the last Update() are pushed, all other bodies keep their
+         * simulated state. Equivalent to calling GameObject::MarkTransformChanged().
+         * @param gameObject The game object that was teleported or edited.
+         * @sharedapi
+         */
+        void MarkDirty(const std::shared_ptr<GameObject>& gameObject);
+
+        /**
+         * The game objects whose transform was written back by the last Update().
+         * Only awake bodies are written back, so sleeping and static bodies never show up in this list.
+         * Writing back does not count as an edit: the manager stores the resulting TransformVersion() so the body
+         * is not pushed back on the next Update(). The renderer can use it to update only what moved.
+         * @return The game objects that moved during the last Update().
+         * @sharedapi
+         */
+        const std::vector<std::weak_ptr<GameObject>>& ChangedObjects() const;
+
+        /**
+         * Write the full state of the physics world into a compact binary buffer.
+         * The buffer is cleared first, so it can be reused between frames without reallocating.
+         * @param buffer The buffer to write the snapshot into.
+         * @sharedapi
+         */
+        void Snapshot(std::vector<std::uint8_t>& buffer) const;
+
+        /**
+         * Restore the physics world and the transforms of its game objects from a snapshot.
+         * Together with PhysicsConfig::deterministic this allows rolling back and re-simulating frames.
+         * @param buffer A buffer previously filled by Snapshot().
+         * @exception A std::runtime_error is thrown when the buffer does not match the current world.
+         * @sharedapi
+         */
+        void Restore(const std::vector<std::uint8_t>& buffer);
+
+        /**
+         * Retrieve the counters of the physics world, e.g. for benchmarks or a debug overlay.
+         * @return The counters as measured during the last Update().
+         * @sharedapi
+         */
+        PhysicsStats Stats() const;
+
     private:
         class PhysicsManagerImpl;
 
@@ -0,0 +1,173 @@
+#ifndef RENDERBACKEND_H_
+#define RENDERBACKEND_H_
+
+#include "GlyphAtlas.hpp"
+#include "RenderCommands.hpp"
+#include "TextureRegistry.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief The interface between the engine and a rasterizer, consumes recorded command buffers.
+     * @sharedapi
+     */
+    class RenderBackend {
+        public:
+            virtual ~RenderBackend() = default;
+
+            /**
+             * @brief Rasterize all commands of a frame.
+             * @param commands The recorded frame.
+             * @sharedapi
+             */
+            virtual void Submit(const RenderCommandBuffer& commands) = 0;
+
+            /**
+             * @brief Show the last submitted frame.
+             * @sharedapi
+             */
+            virtual void Present() = 0;
+    };
+
+    /**
+     * @brief CPU-side access to decoded texture and glyph pixels, sampled by the software backend.
+     * @details The engine implements it on top of the TextureRegistry and the GlyphCache; tests can pass an
+     *          implementation serving fixed images, so golden frames do not depend on files on disk.
+     *          Called from the render thread while it rasterizes, see RenderConfig::renderThread.
+     * @sharedapi
+     */
+    class PixelSource {
+        public:
+            virtual ~PixelSource() = default;
+
+            /**
+             * @brief Get the pixels of a texture.
+             * @param texture The texture, e.g. SpriteQuadCommand::texture or GlyphAtlas::Texture().
+             * @param width Set to the width of the texture in pixels.
+             * @param height Set to the height of the texture in pixels.
+             * @return width * height pixels row by row, or nullptr if the texture is not loaded;
+             *         the quad is then drawn with TextureRegistry::Placeholder(), or skipped if that is missing too.
+             * @sharedapi
+             */
+            virtual const PackedColor* Pixels(TextureHandle texture, int& width, int& height) const = 0;
+
+            /**
+             * @brief Get a rasterized glyph of a text run.
+             * @param font The font of the run, see TextRunCommand::font.
+             * @param size The size of the run.
+             * @param style The style of the run.
+             * @param codepoint The unicode codepoint.
+             * @param texture Set to the texture the glyph lives in, to be passed to Pixels().
+             * @return The glyph, or nullptr if the font is not loaded.
+             * @sharedapi
+             */
+            virtual const spic::Glyph* Glyph(std::uint32_t font, std::uint16_t size, std::uint8_t style,
+                                             char32_t codepoint, TextureHandle& texture) const = 0;
+    };
+
+    /**
+     * @brief An RGBA8 image in memory, the target of the software backend.
+     * @sharedapi
+     */
+    class Framebuffer {
+        public:
+            /**
+             * @brief Constructor.
+             * @param width The width in pixels.
+             * @param height The height in pixels.
+             * @sharedapi
+             */
+            Framebuffer(int width, int height);
+
+            int Width() const { return width; }
+
+            int Height() const { return height; }
+
+            /**
+             * @brief The pixels, row by row.
+             * @sharedapi
+             */
+            const std::vector<PackedColor>& Pixels() const { return pixels; }
+
+            /**
+             * @brief Fill the whole framebuffer with a color.
+             * @param color The color.
+             * @sharedapi
+             */
+            void Clear(PackedColor color);
+
+            /**
+             * @brief Alpha blend a row of source pixels onto the framebuffer.
+             * @details Blends four pixels per iteration with SIMD where the target supports it, the remaining
+             *          pixels are blended one at a time. Results are identical on every path, so hashes can be
+             *          compared between machines.
+             * @param x The first column.
+             * @param y The row.
+             * @param source The source pixels.
+             * @param count The amount of pixels.
+             * @param tint The color every source pixel is multiplied with.
+             * @sharedapi
+             */
+            void BlendRow(int x, int y, const PackedColor* source, int count, PackedColor tint);
+
+            /**
+             * @brief A 64-bit FNV-1a hash of the pixels, used to compare against golden images.
+             * @sharedapi
+             */
+            std::uint64_t Hash() const;
+
+            /**
+             * @brief Write the framebuffer to a PNG file, e.g. to update a golden image.
+             * @param path The path of the image.
+             * @return True if the file was written, false if not.
+             * @sharedapi
+             */
+            bool Save(const std::string& path) const;
+
+        private:
+            int width;
+            int height;
+            std::vector<PackedColor> pixels;
+    };
+
+    /**
+     * @brief A backend that rasterizes sprites, text and debug lines into a Framebuffer without a window or GPU.
+     * @details Selected with RenderConfig::backend. Used for render benchmarks and pixel exact regression tests
+     *          on machines without a display.
+     * @sharedapi
+     */
+    class SoftwareRenderBackend : public RenderBackend {
+        public:
+            /**
+             * @brief Constructor.
+             * @param width The width of the framebuffer.
+             * @param height The height of the framebuffer.
+             * @param pixels The source of texture and glyph pixels, must outlive the backend.
+             * @sharedapi
+             */
+            SoftwareRenderBackend(int width, int height, const PixelSource& pixels);
+
+            void Submit(const RenderCommandBuffer& commands) override;
+
+            /**
+             * @brief Does nothing, there is no window to present to.
+             */
+            void Present() override {}
+
+            /**
+             * @brief The framebuffer containing the last submitted frame.
+             * @sharedapi
+             */
+            const spic::Framebuffer& Framebuffer() const { return framebuffer; }
+
+        private:
+            spic::Framebuffer framebuffer;
+            const PixelSource& pixels;
+    };
+
+}
+
+#endif // RENDERBACKEND_H_
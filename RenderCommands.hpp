@@ -0,0 +1,98 @@
+#ifndef RENDERCOMMANDS_H_
+#define RENDERCOMMANDS_H_
+
+#include "Color.hpp"
+#include "TextureRegistry.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief A textured quad, recorded on the main thread and drawn by the render thread.
+     * @sharedapi
+     */
+    struct SpriteQuadCommand {
+        float x;
+        float y;
+        float width;
+        float height;
+        float rotation;
+        float u0;
+        float v0;
+        float u1;
+        float v1;
+        TextureHandle texture;
+        PackedColor color;
+        std::uint8_t flip; // Bit 0 is flip x, bit 1 is flip y
+    };
+
+    /**
+     * @brief A run of text, its characters live in RenderCommandBuffer::textData.
+     * @sharedapi
+     */
+    struct TextRunCommand {
+        float x;
+        float y;
+        float width;
+        float height;
+        std::uint32_t font;
+        std::uint32_t textOffset;
+        std::uint32_t textLength;
+        PackedColor color;
+        std::uint16_t size;
+        std::uint8_t alignment;
+        std::uint8_t style;
+    };
+
+    /**
+     * @brief A debug line in world coordinates.
+     * @sharedapi
+     */
+    struct DebugLineCommand {
+        float x0;
+        float y0;
+        float x1;
+        float y1;
+        PackedColor color;
+    };
+
+    /**
+     * @brief All commands of one frame. Contains plain data only, so the render thread never touches game objects.
+     * @details The engine keeps RenderConfig::framesInFlight of these buffers. The main thread records frame N+1
+     *          into a free buffer while the render thread rasterizes and presents frame N.
+     * @sharedapi
+     */
+    struct RenderCommandBuffer {
+        std::vector<SpriteQuadCommand> sprites;
+        std::vector<TextRunCommand> texts;
+        std::vector<DebugLineCommand> lines;
+        std::vector<char> textData;
+        PackedColor backgroundColor{0, 0, 0, 255};
+        std::uint64_t frame{0};
+
+        /**
+         * @brief Append a text run, copying its characters into textData.
+         */
+        void AddText(TextRunCommand command, const std::string& text) {
+            command.textOffset = static_cast<std::uint32_t>(textData.size());
+            command.textLength = static_cast<std::uint32_t>(text.size());
+            textData.insert(textData.end(), text.begin(), text.end());
+            texts.push_back(command);
+        }
+
+        /**
+         * @brief Remove all commands, keeping the allocated memory for the next frame.
+         */
+        void Clear() {
+            sprites.clear();
+            texts.clear();
+            lines.clear();
+            textData.clear();
+        }
+    };
+
+}
+
+#endif // RENDERCOMMANDS_H_
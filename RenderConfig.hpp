@@ -0,0 +1,64 @@
+#ifndef RENDERCONFIG_H_
+#define RENDERCONFIG_H_
+
+#include <cstddef>
+#include <string>
+
+namespace spic {
+
+    /**
+     * @brief Enumeration for the different render backends
+     * @sharedapi
+     */
+    enum class RenderBackendType {
+        hardware,
+        software
+    };
+
+    /**
+     * @brief A struct representing the render configuration
+     * @sharedapi
+     */
+    struct RenderConfig {
+
+        /**
+         * @brief The backend that rasterizes frames. The software backend renders into memory without opening a
+         *        window, using WindowConfig::width and WindowConfig::height as framebuffer size
+         */
+        RenderBackendType backend{RenderBackendType::hardware};
+
+        static constexpr int MinFramesInFlight = 2;
+        static constexpr int MaxFramesInFlight = 3;
+
+        /**
+         * @brief A boolean flag if rendering should run on a dedicated thread. Off by default, so games whose
+         *        scripts assume rendering happens on the main thread keep working; enable it to overlap frames
+         */
+        bool renderThread{false};
+
+        /**
+         * @brief The amount of command buffers in flight, MinFramesInFlight to MaxFramesInFlight. More buffers
+         *        allow more overlap at the cost of latency, only used when renderThread is enabled
+         */
+        int framesInFlight{MinFramesInFlight};
+
+        /**
+         * @brief The maximum amount of memory in bytes used by loaded textures, see TextureRegistry
+         */
+        std::size_t textureBudget{256 * 1024 * 1024};
+
+        /**
+         * @brief The texture drawn while the real texture of a sprite is still loading, empty draws nothing
+         */
+        std::string placeholderTexture;
+
+        /**
+         * @brief The maximum amount of texture data in bytes uploaded per frame by the AssetLoader
+         */
+        std::size_t uploadBudget{4 * 1024 * 1024};
+
+    };
+
+}
+
+#endif // RENDERCONFIG_H_
@@ -0,0 +1,164 @@
+#ifndef RENDERQUEUE_H_
+#define RENDERQUEUE_H_
+
+#include "RenderCommands.hpp"
+#include "TextureRegistry.hpp"
+#include "Transform.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace spic {
+
+    class Sprite;
+
+    /**
+     * @brief A single quad draw, recorded by the Camera and consumed by the renderer.
+     * @details Sprites are converted to a quad when pushed, so particles, tilemap chunks and glyphs of a Text
+     *          sort and batch together with them.
+     * @sharedapi
+     */
+    struct DrawCommand {
+        std::uint64_t key;
+        SpriteQuadCommand quad;
+        std::uint32_t cameras; // Bit i is set when camera i sees the draw, see SpatialGrid::Query()
+    };
+
+    /**
+     * @brief A run of sorted draw commands sharing the same texture, submitted as one draw call.
+     * @sharedapi
+     */
+    struct DrawBatch {
+        TextureHandle texture;
+        std::size_t first;
+        std::size_t count;
+    };
+
+    /**
+     * @brief Collects the sprite draws of a frame, sorts them and merges them into texture batches.
+     * @details Every command carries a 64-bit key packing the sorting layer, order in layer, texture handle and
+     *          depth, from most to least significant. Sorting the keys with a radix sort gives the same order
+     *          as comparing Sprite::SortingLayer() and Sprite::OrderInLayer(), while sprites sharing a texture
+     *          within the same order end up next to each other and can be batched.
+     * @sharedapi
+     */
+    class RenderQueue {
+        public:
+            /**
+             * @brief The sorting layer UI objects such as Text are pushed at, above every world sorting layer
+             *        used by sprites.
+             */
+            static constexpr int UiSortingLayer = 127;
+
+            /**
+             * @brief The camera mask of a draw seen by every camera.
+             */
+            static constexpr std::uint32_t AllCameras = 0xFFFFFFFF;
+
+            /**
+             * @brief Pack the sort criteria of a draw into a key.
+             * @param sortingLayer The sorting layer of the sprite, clamped to [-128, 127].
+             * @param orderInLayer The order in layer of the sprite, clamped to [-32768, 32767].
+             * @param texture The texture handle of the sprite, only the lower 24 bits are used.
+             * @param depth A secondary criterion within a texture run, e.g. a quantized y for top-down sorting.
+             *        Do not pass the submission index, it would wrap in large scenes; draws with equal keys
+             *        keep their submission order because Sort() is stable.
+             * @return The packed key.
+             * @sharedapi
+             */
+            static constexpr std::uint64_t MakeKey(int sortingLayer, int orderInLayer, TextureHandle texture,
+                                                   std::uint16_t depth) {
+                return (Bias(sortingLayer, 128, 0xFF) << 56)
+                       | (Bias(orderInLayer, 32768, 0xFFFF) << 40)
+                       | (static_cast<std::uint64_t>(texture & 0xFFFFFF) << 16)
+                       | depth;
+            }
+
+            /**
+             * @brief Extract the texture handle from a key.
+             * @param key The packed key.
+             * @return The texture handle.
+             * @sharedapi
+             */
+            static constexpr TextureHandle KeyTexture(std::uint64_t key) {
+                return static_cast<TextureHandle>((key >> 16) & 0xFFFFFF);
+            }
+
+            /**
+             * @brief Record a sprite draw for this frame.
+             * @param sprite The sprite to draw, converted into a quad right away.
+             * @param transform The world transform of the sprite.
+             * @param texture The texture handle of the sprite, see Sprite::TextureId().
+             * @param cameras The cameras that see the sprite, the visibleIn bits of SpatialGrid::Query().
+             * @sharedapi
+             */
+            void Push(const Sprite& sprite, const Transform& transform, TextureHandle texture,
+                      std::uint32_t cameras = AllCameras);
+
+            /**
+             * @brief Record quads that do not come from a Sprite, e.g. particles, tilemap chunks or glyphs.
+             * @param sortingLayer The sorting layer of the quads, see MakeKey().
+             * @param orderInLayer The order in layer of the quads.
+             * @param quads The quads, copied into the queue; their texture goes into the key.
+             * @param count The amount of quads.
+             * @param depth The secondary criterion shared by the quads, see MakeKey().
+             * @param cameras The cameras that see the quads.
+             * @sharedapi
+             */
+            void Push(int sortingLayer, int orderInLayer, const SpriteQuadCommand* quads, std::size_t count,
+                      std::uint16_t depth = 0, std::uint32_t cameras = AllCameras);
+
+            /**
+             * @brief Radix sort the recorded commands on their key and build the texture batches.
+             * @details The sort is a stable LSD radix sort, so commands with equal keys stay in the order they
+             *          were pushed. Byte passes in which every key has the same value are skipped, so scenes
+             *          using few layers pay for fewer passes.
+             * @sharedapi
+             */
+            void Sort();
+
+            /**
+             * @brief Copy the draws of one camera out of this sorted queue and build its batches.
+             * @details The engine fills one queue with the draws of all cameras and sorts it once; each camera
+             *          then takes its draws in the already sorted order, which is a linear copy instead of a sort.
+             * @param camera The index of the camera, the bit tested in DrawCommand::cameras.
+             * @param result Cleared, then filled with the commands and batches of the camera.
+             * @sharedapi
+             */
+            void Filter(std::size_t camera, RenderQueue& result) const;
+
+            /**
+             * @brief The recorded commands, in draw order after Sort().
+             * @return The commands.
+             * @sharedapi
+             */
+            const std::vector<DrawCommand>& Commands() const { return commands; }
+
+            /**
+             * @brief The texture batches built by the last Sort().
+             * @return The batches, in draw order.
+             * @sharedapi
+             */
+            const std::vector<DrawBatch>& Batches() const { return batches; }
+
+            /**
+             * @brief Remove all commands and batches, keeping the allocated memory for the next frame.
+             * @sharedapi
+             */
+            void Clear();
+
+        private:
+            // Clamps before adding the bias, so values near the limits of int do not overflow
+            static constexpr std::uint64_t Bias(int value, int bias, int max) {
+                const int clamped = value < -bias ? -bias : (value > max - bias ? max - bias : value);
+                return static_cast<std::uint64_t>(clamped + bias);
+            }
+
+            std::vector<DrawCommand> commands;
+            std::vector<DrawCommand> scratch;
+            std::vector<DrawBatch> batches;
+    };
+
+}
+
+#endif // RENDERQUEUE_H_
@@ -28,9 +28,11 @@ namespace spic {
              * @param gravityScale The scale of the gravity of the rigid body
              * @param bodyType The type of the rigid body
              * @param linearDamping The linear damping, can be used to prevent ice-skating
+             * @param continuousCollision Sweep this body against other colliders to prevent tunneling at high speed
              * @sharedapi
              */
-            RigidBody(double mass, double gravityScale, const BodyType& bodyType, float linearDamping = 0.0);
+            RigidBody(double mass, double gravityScale, const BodyType& bodyType, float linearDamping = 0.0,
+                      bool continuousCollision = false);
 
             /**
              * @brief Apply force to this rigid body.
@@ -88,12 +90,31 @@ namespace spic {
 
             float LinearDamping() const;
 
+            /**
+             * @brief Whether this body uses continuous collision detection.
+             * @details When enabled the physics step sweeps the body's collider from its previous
+             *          to its new position and stops it at the first time of impact, so fast bodies
+             *          (e.g. projectiles) do not tunnel through thin colliders. Only bodies with this
+             *          flag set pay for the sweep; all other bodies use the regular discrete step.
+             * @return The current value.
+             * @sharedapi
+             */
+            bool ContinuousCollision() const;
+
+            /**
+             * @brief Whether this body uses continuous collision detection.
+             * @param newContinuousCollision The desired value.
+             * @sharedapi
+             */
+            void ContinuousCollision(bool newContinuousCollision);
+
         private:
             double mass;
             double gravityScale;
             BodyType bodyType;
             Point force;
             float linearDamping;
+            bool continuousCollision;
     };
 
 }
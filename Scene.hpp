@@ -1,11 +1,17 @@
 #ifndef SCENE_H_
 #define SCENE_H_
 
+#include "AnimationSystem.hpp"
+#include "SpatialGrid.hpp"
+#include "StaticLayerCache.hpp"
+#include "TweenSystem.hpp"
+#include <string>
 #include <vector>
 #include <memory>
 
 namespace spic {
 
+    class Camera;
     class GameObject;
 
     /**
@@ -25,6 +31,7 @@ namespace spic {
 
             /**
              * @brief This function is called by a Camera to render the scene on the engine.
+             * @details Sprites are pushed into a RenderQueue rather than drawn during the scene walk.
              * @spicapi
              */
             void RenderScene();
@@ -35,6 +42,52 @@ namespace spic {
              */
             std::vector<std::shared_ptr<GameObject>>& Contents();
 
+            /**
+             * @brief The grid with the bounds of every sprite, text and collider overlay in this scene.
+             * @details Kept up to date incrementally by SpatialGrid::Sync() before every frame: only objects that
+             *          are new or whose world transform version changed are re-inserted.
+             * @sharedapi
+             */
+            SpatialGrid& RenderGrid();
+
+            /**
+             * @brief The cache of the sorting layers that are marked static, e.g. backgrounds and level geometry.
+             * @details Static game objects (see GameObject::Static()) that move, or whose sprite changes,
+             *          invalidate the cached tiles they overlap.
+             * @sharedapi
+             */
+            StaticLayerCache& StaticLayers();
+
+            /**
+             * @brief The active cameras in this scene, ordered by Camera::Depth().
+             * @details The engine passes the view of every camera to one SpatialGrid::Query() call, which visits
+             *          each covered cell once and tags every object with the cameras that see it. Every object is
+             *          pushed once into a shared RenderQueue with those tags, which is sorted once; each camera
+             *          then takes its draws with RenderQueue::Filter(). At most SpatialGrid::MaxQueryAreas cameras
+             *          can be active.
+             * @sharedapi
+             */
+            std::vector<std::shared_ptr<Camera>> Cameras() const;
+
+            /**
+             * @brief The animation state of all Animators in this scene.
+             * @sharedapi
+             */
+            AnimationSystem& Animations();
+
+            /**
+             * @brief The tweens of this scene, advanced once per frame by the engine.
+             * @sharedapi
+             */
+            TweenSystem& Tweens();
+
+            /**
+             * @brief The audio clips decoded before this scene is activated, so playing them never waits on decoding.
+             * @details Add the clips in the constructor or OnCreate().
+             * @sharedapi
+             */
+            std::vector<std::string>& PreloadAudio();
+
             /**
              * Called when this scene is first created.
              * Use this method to initialize the objects in this scene.
@@ -57,6 +110,11 @@ namespace spic {
 
     private:
         std::vector<std::shared_ptr<GameObject>> contents;
+        SpatialGrid renderGrid;
+        StaticLayerCache staticLayers;
+        AnimationSystem animations;
+        TweenSystem tweens;
+        std::vector<std::string> preloadAudio;
     };
 
 }
@@ -0,0 +1,150 @@
+#ifndef SPATIALGRID_H_
+#define SPATIALGRID_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace spic {
+
+    class GameObject;
+
+    /**
+     * @brief An axis aligned rectangle in world coordinates.
+     * @sharedapi
+     */
+    struct Bounds {
+        double minX;
+        double minY;
+        double maxX;
+        double maxY;
+
+        bool Intersects(const Bounds& other) const {
+            return minX <= other.maxX && maxX >= other.minX && minY <= other.maxY && maxY >= other.minY;
+        }
+    };
+
+    /**
+     * @brief A uniform grid of renderable bounds, used by the Camera to skip off-screen objects.
+     * @details An object is stored in every cell its bounds overlap, so a query only visits the cells under the
+     *          queried rectangle and reports each object once. Objects overlapping more than MaxCellsPerObject
+     *          cells, e.g. backgrounds, are kept in a separate list that every query tests directly, so one huge
+     *          object neither fills many cells nor widens the queries for all other objects.
+     *          Moving an object only touches the cells it enters or leaves.
+     * @sharedapi
+     */
+    class SpatialGrid {
+        public:
+            static constexpr int MaxCellsPerObject = 16;
+            static constexpr std::size_t MaxQueryAreas = 32;
+
+            /**
+             * @brief Constructor.
+             * @param cellSize The width and height of a cell in world units.
+             * @sharedapi
+             */
+            explicit SpatialGrid(double cellSize = 256.0);
+
+            /**
+             * @brief Add an object, or update its bounds if it is already in the grid.
+             * @param gameObject The object.
+             * @param bounds The world bounds of the object.
+             * @param version The world transform version the bounds were computed at, see WorldVersion().
+             * @sharedapi
+             */
+            void Update(const std::shared_ptr<GameObject>& gameObject, const Bounds& bounds,
+                        std::uint64_t version = 0);
+
+            /**
+             * @brief Bring the grid in line with the objects of a scene, called by the engine before rendering.
+             * @details Objects that are not in the grid yet, e.g. pushed into Scene::Contents() after the scene
+             *          was built, are inserted. Objects whose WorldVersion() differs from the one stored are
+             *          re-inserted, which covers every tracked edit (the GameObject::Transform() setter,
+             *          MarkTransformChanged(), ForcePositionTo(), TweenSystem::Move() and physics write-back) as
+             *          well as children of a moved parent. Objects in the grid that are not passed in are removed.
+             * @param objects All game objects of the scene, including children.
+             * @param bounds Computes the world bounds of an object, only called for inserted and changed objects.
+             * @sharedapi
+             */
+            void Sync(const std::vector<std::shared_ptr<GameObject>>& objects,
+                      const std::function<Bounds(const GameObject&)>& bounds);
+
+            /**
+             * @brief The version of an object's world transform.
+             * @details The largest GameObject::TransformVersion() of the object and all of its parents. Versions
+             *          are stamped from one global counter, so any later edit of the object or of a parent,
+             *          including reparenting (which stamps the child), yields a larger value than before.
+             * @param gameObject The object.
+             * @return The version.
+             * @sharedapi
+             */
+            static std::uint64_t WorldVersion(const GameObject& gameObject);
+
+            /**
+             * @brief Remove an object from the grid.
+             * @param gameObject The object.
+             * @sharedapi
+             */
+            void Remove(const std::shared_ptr<GameObject>& gameObject);
+
+            /**
+             * @brief Collect the objects whose bounds intersect a rectangle.
+             * @param area The rectangle, e.g. Camera::ViewBounds().
+             * @param result The vector to append the objects to, so it can be reused between frames.
+             * @sharedapi
+             */
+            void Query(const Bounds& area, std::vector<std::shared_ptr<GameObject>>& result) const;
+
+            /**
+             * @brief Collect the objects whose bounds intersect any of several rectangles, each object once.
+             * @details Every cell covered by at least one rectangle is visited once, so overlapping camera views
+             *          only share the work of their overlap, while the cells between disjoint views (e.g.
+             *          split-screen players far apart) are not visited at all.
+             * @param areas The rectangles, e.g. the Camera::ViewBounds() of every camera, at most MaxQueryAreas.
+             * @param result The vector to append the objects to.
+             * @param visibleIn Appended in step with result: bit i is set when the object intersects areas[i].
+             * @throws std::out_of_range If more than MaxQueryAreas rectangles are passed.
+             * @sharedapi
+             */
+            void Query(const std::vector<Bounds>& areas, std::vector<std::shared_ptr<GameObject>>& result,
+                       std::vector<std::uint32_t>& visibleIn) const;
+
+            /**
+             * @brief Remove all objects from the grid.
+             * @sharedapi
+             */
+            void Clear();
+
+            /**
+             * @brief The amount of objects in the grid.
+             * @sharedapi
+             */
+            std::size_t Size() const { return locations.size(); }
+
+        private:
+            struct Entry {
+                std::weak_ptr<GameObject> gameObject;
+                Bounds bounds;
+                std::uint64_t version;
+                // Set to the query counter when reported, so objects spanning several cells are reported once
+                mutable std::uint64_t lastQuery;
+                bool large;
+            };
+
+            std::int64_t CellKey(int cellX, int cellY) const;
+
+            double cellSize;
+            mutable std::uint64_t queryCount;
+            std::unordered_map<std::int64_t, std::vector<int>> cells;
+            std::vector<int> large;
+
+            // Maps GameObject::Id() to the entry of the object
+            std::unordered_map<int, Entry> locations;
+    };
+
+}
+
+#endif // SPATIALGRID_H_
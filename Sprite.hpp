@@ -3,6 +3,8 @@
 
 #include "Component.hpp"
 #include "Color.hpp"
+#include "TextureRegistry.hpp"
+#include <cstdint>
 #include <string>
 
 namespace spic {
@@ -38,6 +40,8 @@ namespace spic {
 
             /**
              * @brief The texture of the sprite
+             * @details Interns the path in the engine's TextureRegistry, prefer the handle overload when
+             *          switching textures every frame.
              * @param sprite the path to the sprite
              * @sharedapi
              */
@@ -45,10 +49,25 @@ namespace spic {
 
             /**
              * @brief The texture of the sprite
-             * @return The path of the sprite
+             * @param handle the handle of the texture, as returned by TextureRegistry::Intern
              * @sharedapi
              */
-            const std::string& Texture() const;
+            void Texture(TextureHandle handle);
+
+            /**
+             * @brief The texture of the sprite
+             * @details Looks the path up in the engine's TextureRegistry, use TextureId() in per-frame code.
+             * @return A copy of the path of the sprite, see TextureRegistry::Path()
+             * @sharedapi
+             */
+            std::string Texture() const;
+
+            /**
+             * @brief The texture of the sprite
+             * @return The handle of the texture
+             * @sharedapi
+             */
+            TextureHandle TextureId() const;
 
             /**
              * @brief The color of the sprite
@@ -62,7 +81,14 @@ namespace spic {
              * @return the color
              * @sharedapi
              */
-            const spic::Color& Color() const;
+            spic::Color Color() const;
+
+            /**
+             * @brief The color of the sprite as stored and drawn, without converting from doubles
+             * @return the packed color
+             * @sharedapi
+             */
+            spic::PackedColor PackedColor() const { return color; }
 
             /**
              * @brief Whether the sprite should be flipped on the X-axis
@@ -133,14 +159,25 @@ namespace spic {
              */
             void CutoffWidth(double newValue);
 
+            /**
+             * @brief A counter incremented by every setter of this sprite, including texture changes written back
+             *        by the AnimationSystem
+             * @details Systems caching what the sprite looks like, such as the StaticLayerCache, store the version
+             *          they rendered and compare it every frame instead of receiving notifications.
+             * @return the current version
+             * @sharedapi
+             */
+            std::uint64_t Version() const { return version; }
+
         private:
-            std::string sprite;
-            spic::Color color;
+            TextureHandle texture;
+            spic::PackedColor color;
             bool flipX;
             bool flipY;
             int sortingLayer;
             int orderInLayer;
             double cutoffWidth;
+            std::uint64_t version;
     };
 
 }
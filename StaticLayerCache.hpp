@@ -0,0 +1,132 @@
+#ifndef STATICLAYERCACHE_H_
+#define STATICLAYERCACHE_H_
+
+#include "SpatialGrid.hpp"
+#include "TextureRegistry.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief Offscreen tiles holding pre-rendered static sorting layers.
+     * @details A static layer is drawn once per tile of tileSize x tileSize world units, the first time a camera
+     *          views that tile. After that the renderer blits the cached tiles instead of drawing the sprites in
+     *          them, until a contained sprite or transform changes and the affected tiles are invalidated.
+     *          Changes are detected by polling, not by notification: every frame the engine compares the
+     *          Sprite::Version() and GameObject::TransformVersion() of each static sprite with the versions
+     *          recorded when its tiles were rendered, and invalidates the old and new bounds of the sprites that
+     *          differ. Animated sprites on a static layer therefore re-render their tiles whenever their frame
+     *          changes; keep them on a dynamic layer.
+     *          Tiles are rendered at the pixel density of the viewing camera, so they are cached per camera scale
+     *          (quantized to 1/64); cameras zooming continuously therefore re-render tiles and gain little.
+     *          Tile textures are made with TextureRegistry::Create() and are never evicted by the registry;
+     *          dropped tiles are handed back through TakeReleased() so the renderer can Release() them.
+     * @sharedapi
+     */
+    class StaticLayerCache {
+        public:
+            /**
+             * @brief Constructor.
+             * @param tileSize The width and height of a tile in world units.
+             * @sharedapi
+             */
+            explicit StaticLayerCache(double tileSize = 512.0);
+
+            /**
+             * @brief Mark a sorting layer as static or dynamic.
+             * @param sortingLayer The sorting layer, see Sprite::SortingLayer().
+             * @param isStatic True to cache the layer, false to draw it every frame.
+             * @sharedapi
+             */
+            void Static(int sortingLayer, bool isStatic);
+
+            /**
+             * @brief Check if a sorting layer is cached.
+             * @param sortingLayer The sorting layer.
+             * @return True if the layer is static.
+             * @sharedapi
+             */
+            bool Static(int sortingLayer) const;
+
+            /**
+             * @brief Get the cached tile of a layer at a world position.
+             * @param sortingLayer The sorting layer.
+             * @param x The world x coordinate.
+             * @param y The world y coordinate.
+             * @param scale The amount of pixels per world unit of the viewing camera.
+             * @return The texture of the tile, or TextureRegistry::InvalidHandle if it has to be rendered first.
+             * @sharedapi
+             */
+            TextureHandle Tile(int sortingLayer, double x, double y, double scale) const;
+
+            /**
+             * @brief Store a rendered tile.
+             * @param sortingLayer The sorting layer.
+             * @param x A world x coordinate inside the tile.
+             * @param y A world y coordinate inside the tile.
+             * @param scale The amount of pixels per world unit the tile was rendered at.
+             * @param texture The offscreen texture the tile was rendered into, made with TextureRegistry::Create().
+             * @sharedapi
+             */
+            void Tile(int sortingLayer, double x, double y, double scale, TextureHandle texture);
+
+            /**
+             * @brief Drop the cached tiles of a layer that overlap an area, at every scale, e.g. the old and new
+             *        bounds of a moved sprite.
+             * @param sortingLayer The sorting layer.
+             * @param area The changed area.
+             * @sharedapi
+             */
+            void Invalidate(int sortingLayer, const Bounds& area);
+
+            /**
+             * @brief Drop all cached tiles of a layer.
+             * @param sortingLayer The sorting layer.
+             * @sharedapi
+             */
+            void Invalidate(int sortingLayer);
+
+            /**
+             * @brief The world size of a tile.
+             * @sharedapi
+             */
+            double TileSize() const { return tileSize; }
+
+            /**
+             * @brief Take the textures of the tiles dropped since the last call.
+             * @return The textures, to be passed to TextureRegistry::Release().
+             * @sharedapi
+             */
+            std::vector<TextureHandle> TakeReleased();
+
+        private:
+            struct TileKey {
+                int sortingLayer;
+                std::int32_t x;
+                std::int32_t y;
+                std::int32_t scale; // pixels per world unit * 64
+
+                bool operator==(const TileKey& other) const {
+                    return sortingLayer == other.sortingLayer && x == other.x && y == other.y && scale == other.scale;
+                }
+            };
+
+            struct TileKeyHash {
+                std::size_t operator()(const TileKey& key) const;
+            };
+
+            TileKey MakeKey(int sortingLayer, double x, double y, double scale) const;
+
+            double tileSize;
+            std::set<int> staticLayers;
+            std::unordered_map<TileKey, TextureHandle, TileKeyHash> tiles;
+            std::vector<TextureHandle> released;
+    };
+
+}
+
+#endif // STATICLAYERCACHE_H_
@@ -3,6 +3,7 @@
 
 #include "UIObject.hpp"
 #include "Color.hpp"
+#include "GlyphAtlas.hpp"
 #include <string>
 
 namespace spic {
@@ -69,6 +70,7 @@ namespace spic {
 
             /**
              * @brief Set the text content of the Text object
+             * @details Invalidates the cached layout if the content changed.
              * @param text new content
              * @sharedapi
              */
@@ -83,6 +85,7 @@ namespace spic {
 
             /**
              * @brief Set the font of the Text object
+             * @details Invalidates the cached layout.
              * @param font the new font
              * @sharedapi
              */
@@ -97,6 +100,7 @@ namespace spic {
 
             /**
              * @brief Set the size of the Text object
+             * @details Invalidates the cached layout.
              * @param size the new size
              * @sharedapi
              */
@@ -111,6 +115,7 @@ namespace spic {
 
             /**
              * @brief Set the alignment of the content of the Text object
+             * @details Invalidates the cached layout.
              * @param alignment the new alignment
              * @sharedapi
              */
@@ -118,13 +123,21 @@ namespace spic {
 
             /**
              * @brief Get the color of the Text object
-             * @return A reference to the color of the Text object
+             * @return The color of the Text object
              * @sharedapi
              */
-            const Color& TextColor() const;
+            Color TextColor() const;
+
+            /**
+             * @brief Get the color of the Text object as stored and drawn
+             * @return The packed color of the Text object
+             * @sharedapi
+             */
+            PackedColor PackedTextColor() const { return color; }
 
             /**
              * @brief Set the color of the Text object
+             * @details Invalidates the cached layout.
              * @param color the new color
              * @sharedapi
              */
@@ -132,13 +145,27 @@ namespace spic {
 
             FontStyle GetFontStyle() const;
 
+            /**
+             * @brief Get the laid out glyphs of the Text object
+             * @details The layout is only rebuilt after one of the setters above changed it, or when
+             *          GlyphCache::Generation() moved on because the atlas was cleared or reset, so drawing an
+             *          unchanged text costs no layout or rasterization work.
+             * @param glyphCache The cache providing the atlas of the font, size and style of this Text object
+             * @return The cached layout
+             * @sharedapi
+             */
+            const TextLayout& Layout(GlyphCache& glyphCache) const;
+
         private:
             std::string text;
             std::string font;
             int size;
             Alignment alignment;
-            Color color;
+            PackedColor color;
             FontStyle fontStyle;
+
+            mutable TextLayout layout;
+            mutable bool layoutDirty;
     };
 
 }
@@ -0,0 +1,218 @@
+#ifndef TEXTUREATLAS_H_
+#define TEXTUREATLAS_H_
+
+#include "Color.hpp"
+#include "TextureRegistry.hpp"
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief A rectangle in pixels inside an atlas page.
+     * @sharedapi
+     */
+    struct AtlasRect {
+        int x;
+        int y;
+        int width;
+        int height;
+    };
+
+    /**
+     * @brief The location of a packed sprite texture: its page and UV rectangle.
+     * @sharedapi
+     */
+    struct AtlasRegion {
+        int page;
+        AtlasRect rect;
+        double u0;
+        double v0;
+        double u1;
+        double v1;
+    };
+
+    /**
+     * @brief Packs rectangles into a fixed size page using the skyline bottom-left heuristic.
+     * @sharedapi
+     */
+    class SkylinePacker {
+        public:
+            /**
+             * @brief Constructor.
+             * @param width The width of the page.
+             * @param height The height of the page.
+             * @param padding The amount of empty pixels around every rectangle, prevents bleeding when filtering.
+             * @sharedapi
+             */
+            SkylinePacker(int width, int height, int padding = 1);
+
+            /**
+             * @brief Find a place for a rectangle and reserve it.
+             * @param width The width of the rectangle.
+             * @param height The height of the rectangle.
+             * @return The reserved rectangle, or an empty optional if the page is full.
+             * @sharedapi
+             */
+            std::optional<AtlasRect> Insert(int width, int height);
+
+            /**
+             * @brief Remove all reserved rectangles.
+             * @sharedapi
+             */
+            void Clear();
+
+            /**
+             * @brief The fraction of the page that is reserved.
+             * @return A value between 0.0 and 1.0.
+             * @sharedapi
+             */
+            double Occupancy() const;
+
+        private:
+            struct SkylineNode {
+                int x;
+                int y;
+                int width;
+            };
+
+            int width;
+            int height;
+            int padding;
+            long usedArea;
+            std::vector<SkylineNode> skyline;
+    };
+
+    /**
+     * @brief A set of atlas pages together with a manifest that maps Sprite::Texture() paths to regions.
+     * @details The atlas can be built offline over an asset directory and saved as a manifest, or filled at
+     *          runtime for dynamically loaded sprites; both use the same SkylinePacker. Sprites keep referring to
+     *          their original path, the renderer resolves it through Find() and binds PageTexture().
+     *          Every page keeps its RGBA8 pixels in memory, Add() copies the image into them and marks the page
+     *          for the next Upload().
+     * @sharedapi
+     */
+    class TextureAtlas {
+        public:
+            /**
+             * @brief Constructor.
+             * @param pageWidth The width of every page.
+             * @param pageHeight The height of every page.
+             * @sharedapi
+             */
+            TextureAtlas(int pageWidth, int pageHeight);
+
+            /**
+             * @brief Destructor, releases the page textures made by Upload().
+             */
+            ~TextureAtlas();
+
+            TextureAtlas(const TextureAtlas&) = delete;
+            TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+            /**
+             * @brief Pack all images in a directory (recursively).
+             * @param directory The asset directory.
+             * @return The amount of images packed.
+             * @sharedapi
+             */
+            int Build(const std::string& directory);
+
+            /**
+             * @brief Pack a single image, adding a page if it does not fit in the existing ones.
+             * @param texture The path of the image, as used by Sprite::Texture().
+             * @return The region of the image, or an empty optional if it could not be loaded or is larger than a page.
+             * @sharedapi
+             */
+            std::optional<AtlasRegion> Add(const std::string& texture);
+
+            /**
+             * @brief Look up where a texture is packed.
+             * @param texture The path of the image, as used by Sprite::Texture().
+             * @return A pointer to the region, or nullptr if the texture is not in the atlas.
+             * @sharedapi
+             */
+            const AtlasRegion* Find(const std::string& texture) const;
+
+            /**
+             * @brief Look up where a texture is packed without a string lookup, for per-frame use by the renderer.
+             * @param texture The handle of the image, see Sprite::TextureId().
+             * @return A pointer to the region, or nullptr if the texture is not in the atlas or was added after
+             *         the last Upload().
+             * @sharedapi
+             */
+            const AtlasRegion* Find(TextureHandle texture) const;
+
+            /**
+             * @brief The amount of pages in this atlas.
+             * @return The amount of pages, AtlasRegion::page ranges from 0 to PageCount() - 1.
+             * @sharedapi
+             */
+            int PageCount() const;
+
+            /**
+             * @brief The pixels of a page.
+             * @param page The index of the page.
+             * @return pageWidth * pageHeight pixels, row by row.
+             * @sharedapi
+             */
+            const std::vector<PackedColor>& PagePixels(int page) const;
+
+            /**
+             * @brief The texture the renderer binds to draw regions of a page.
+             * @param page The index of the page.
+             * @return The texture, or TextureRegistry::InvalidHandle if the page was not uploaded yet.
+             * @sharedapi
+             */
+            TextureHandle PageTexture(int page) const;
+
+            /**
+             * @brief Create the textures of new pages and upload the pages changed since the last call.
+             * @details Called by the renderer once per frame, before drawing. Page textures are made with
+             *          TextureRegistry::Create(), so they are never evicted; the atlas releases them again when it
+             *          is destroyed. Also interns the paths of new regions, so Find(TextureHandle) knows them.
+             *          Every call must pass the same registry.
+             * @param registry The registry owning the page textures.
+             * @sharedapi
+             */
+            void Upload(TextureRegistry& registry);
+
+            /**
+             * @brief Write the pages as images and the manifest next to them.
+             * @param path The path of the manifest, pages are written as <path>.<page>.png.
+             * @return True if everything was written, false if not.
+             * @sharedapi
+             */
+            bool Save(const std::string& path) const;
+
+            /**
+             * @brief Load pages and manifest written by Save().
+             * @param path The path of the manifest.
+             * @return True if the atlas was loaded, false if not.
+             * @sharedapi
+             */
+            bool Load(const std::string& path);
+
+        private:
+            struct Page {
+                SkylinePacker packer;
+                std::vector<PackedColor> pixels;
+                TextureHandle texture;
+                bool dirty;
+            };
+
+            int pageWidth;
+            int pageHeight;
+            TextureRegistry* registry{nullptr}; // Set by the first Upload()
+            std::vector<Page> pages;
+            std::map<std::string, AtlasRegion> regions;
+
+            // Indexed by TextureHandle, filled by Upload(); points into regions, whose nodes never move
+            std::vector<const AtlasRegion*> regionsByHandle;
+    };
+
+}
+
+#endif // TEXTUREATLAS_H_
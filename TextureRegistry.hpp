@@ -0,0 +1,145 @@
+#ifndef TEXTUREREGISTRY_H_
+#define TEXTUREREGISTRY_H_
+
+#include "Color.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace spic {
+
+    /**
+     * @brief A small integer identifying an interned texture path, 0 means no texture.
+     * @sharedapi
+     */
+    using TextureHandle = std::uint32_t;
+
+    /**
+     * @brief Interns texture paths into handles and caches the loaded textures within a memory budget.
+     * @details Interning a path is done once, e.g. when a Sprite or Animator is created; after that drawing a
+     *          sprite only indexes into the registry. Loaded textures are evicted least recently used first when
+     *          the budget is exceeded, and textures not used by any sprite are evicted when a scene is popped.
+     *          Handles stay valid after eviction, the texture is reloaded on its next use.
+     *          All members are safe to call from any thread: the game thread interns and touches, the
+     *          AssetLoader workers mark textures as loaded and the render thread resolves handles.
+     * @sharedapi
+     */
+    class TextureRegistry {
+        public:
+            static constexpr TextureHandle InvalidHandle = 0;
+
+            /**
+             * @brief Constructor.
+             * @param budgetBytes The maximum amount of memory used by loaded textures.
+             * @sharedapi
+             */
+            explicit TextureRegistry(std::size_t budgetBytes);
+
+            /**
+             * @brief Destructor.
+             * @sharedapi
+             */
+            ~TextureRegistry();
+
+            /**
+             * @brief Get the handle of a path, creating one on first use. Does not load the texture.
+             * @param path The path of the texture.
+             * @return The handle of the path.
+             * @sharedapi
+             */
+            TextureHandle Intern(const std::string& path);
+
+            /**
+             * @brief Create an offscreen texture, e.g. for a RenderTarget, a StaticLayerCache tile or an atlas page.
+             * @details The texture has no path and is pinned: neither the budget nor EvictUnusedSince() evicts it,
+             *          since its contents cannot be reloaded. Its memory counts towards UsedBytes() until Release().
+             * @param width The width in pixels.
+             * @param height The height in pixels.
+             * @return The handle of the texture.
+             * @sharedapi
+             */
+            TextureHandle Create(int width, int height);
+
+            /**
+             * @brief Replace the pixels of a texture made by Create(), e.g. an atlas page that got new images.
+             * @details The pixels are copied, the upload itself happens on the render thread before the next frame.
+             * @param handle The handle of the texture.
+             * @param pixels width * height pixels, row by row.
+             * @sharedapi
+             */
+            void Upload(TextureHandle handle, const PackedColor* pixels);
+
+            /**
+             * @brief Free a texture made by Create(). The handle may be returned by a later Create().
+             * @param handle The handle, interned paths are ignored.
+             * @sharedapi
+             */
+            void Release(TextureHandle handle);
+
+            /**
+             * @brief Get the path of a handle.
+             * @param handle The handle.
+             * @return A copy of the path, or an empty string for InvalidHandle and textures made by Create(). Returned by value because
+             *         another thread may intern a path and grow the storage while the caller holds it.
+             * @sharedapi
+             */
+            std::string Path(TextureHandle handle) const;
+
+            /**
+             * @brief Mark a texture as used this frame, loading it if needed.
+             * @param handle The handle.
+             * @sharedapi
+             */
+            void Touch(TextureHandle handle);
+
+            /**
+             * @brief Check if a texture is loaded and can be drawn.
+             * @param handle The handle.
+             * @return True if the texture is loaded, false if it is still being streamed in by the AssetLoader.
+             * @sharedapi
+             */
+            bool IsReady(TextureHandle handle) const;
+
+            /**
+             * @brief The texture drawn in place of textures that are not ready yet, see RenderConfig::placeholderTexture.
+             * @sharedapi
+             */
+            TextureHandle Placeholder() const;
+
+            /**
+             * @brief Evict textures that were not used since the given frame.
+             * @details Called by Engine::PopScene() after the popped scene released its sprites.
+             * @param frame The first frame that counts as in use.
+             * @sharedapi
+             */
+            void EvictUnusedSince(std::uint64_t frame);
+
+            /**
+             * @brief The memory budget of the loaded textures.
+             * @sharedapi
+             */
+            std::size_t Budget() const;
+
+            /**
+             * @brief Set the memory budget, evicting textures if the new budget is exceeded.
+             * @param newBudgetBytes The desired value.
+             * @sharedapi
+             */
+            void Budget(std::size_t newBudgetBytes);
+
+            /**
+             * @brief The memory currently used by loaded textures.
+             * @sharedapi
+             */
+            std::size_t UsedBytes() const;
+
+        private:
+            class TextureRegistryImpl;
+
+            std::unique_ptr<TextureRegistryImpl> impl;
+    };
+
+}
+
+#endif // TEXTUREREGISTRY_H_
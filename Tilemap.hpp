@@ -0,0 +1,167 @@
+#ifndef TILEMAP_H_
+#define TILEMAP_H_
+
+#include "Component.hpp"
+#include "RenderCommands.hpp"
+#include "SpatialGrid.hpp"
+#include "TextureRegistry.hpp"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace spic {
+
+    /**
+     * @brief A square block of tiles, the unit in which a Tilemap is rendered and gets its physics shapes.
+     * @sharedapi
+     */
+    struct TilemapChunk {
+        int chunkX;
+        int chunkY;
+
+        /**
+         * @brief The tile indices, row by row, 0 is an empty tile.
+         */
+        std::vector<std::uint16_t> tiles;
+
+        /**
+         * @brief The quads of all non-empty tiles, rebuilt when a tile in this chunk changes.
+         */
+        std::vector<SpriteQuadCommand> mesh;
+
+        /**
+         * @brief The solid tiles merged into as few rectangles as possible, in world coordinates.
+         *        Each rectangle becomes a static box shape in the physics world.
+         */
+        std::vector<Bounds> colliders;
+
+        bool meshDirty;
+        bool collidersDirty;
+    };
+
+    /**
+     * @brief A component storing a grid of tiles in fixed size chunks.
+     * @details Replaces a GameObject with a Sprite and BoxCollider per tile. The meshes of visible chunks are
+     *          pushed into the RenderQueue at the tilemap's sorting layer and order, so they sort against sprites
+     *          and batch on the tileset texture, and every chunk adds a few merged static shapes to the physics
+     *          world instead of one body per tile.
+     * @sharedapi
+     */
+    class Tilemap : public Component {
+        public:
+            /**
+             * @brief Constructor.
+             * @param tileset The path of the tileset texture, tiles are numbered from 1 row by row.
+             * @param tileWidth The width of a tile in pixels.
+             * @param tileHeight The height of a tile in pixels.
+             * @param chunkSize The width and height of a chunk in tiles.
+             * @sharedapi
+             */
+            Tilemap(const std::string& tileset, int tileWidth, int tileHeight, int chunkSize = 32);
+
+            /**
+             * @brief Set a tile, creating its chunk if needed.
+             * @param x The tile column, may be negative.
+             * @param y The tile row, may be negative.
+             * @param tile The tile index, 0 clears the tile.
+             * @sharedapi
+             */
+            void Tile(int x, int y, std::uint16_t tile);
+
+            /**
+             * @brief Get a tile.
+             * @param x The tile column.
+             * @param y The tile row.
+             * @return The tile index, 0 if the tile is empty.
+             * @sharedapi
+             */
+            std::uint16_t Tile(int x, int y) const;
+
+            /**
+             * @brief Set if a tile index collides.
+             * @param tile The tile index.
+             * @param solid A boolean flag if tiles with this index should get a physics shape.
+             * @sharedapi
+             */
+            void Solid(std::uint16_t tile, bool solid);
+
+            /**
+             * @brief Get if a tile index collides.
+             * @param tile The tile index.
+             * @return True if tiles with this index get a physics shape.
+             * @sharedapi
+             */
+            bool Solid(std::uint16_t tile) const;
+
+            /**
+             * @brief Remove all tiles and chunks.
+             * @sharedapi
+             */
+            void Clear();
+
+            /**
+             * @brief Rebuild the meshes and colliders of chunks whose tiles changed since the last call.
+             * @sharedapi
+             */
+            void RebuildDirtyChunks();
+
+            /**
+             * @brief The chunks of this tilemap, keyed by chunk coordinates.
+             * @sharedapi
+             */
+            const std::map<std::pair<int, int>, TilemapChunk>& Chunks() const { return chunks; }
+
+            /**
+             * @brief The tileset texture.
+             * @sharedapi
+             */
+            TextureHandle Tileset() const { return tileset; }
+
+            int TileWidth() const { return tileWidth; }
+
+            int TileHeight() const { return tileHeight; }
+
+            int ChunkSize() const { return chunkSize; }
+
+            /**
+             * @brief The layer the tiles will be sorted on, see Sprite::SortingLayer().
+             * @sharedapi
+             */
+            int SortingLayer() const { return sortingLayer; }
+
+            /**
+             * @brief Set the layer the tiles will be sorted on.
+             * @param newSortingLayer The desired value.
+             * @sharedapi
+             */
+            void SortingLayer(int newSortingLayer) { sortingLayer = newSortingLayer; }
+
+            /**
+             * @brief The order of the tiles within their sorting layer, see Sprite::OrderInLayer().
+             * @sharedapi
+             */
+            int OrderInLayer() const { return orderInLayer; }
+
+            /**
+             * @brief Set the order of the tiles within their sorting layer.
+             * @param newOrderInLayer The desired value.
+             * @sharedapi
+             */
+            void OrderInLayer(int newOrderInLayer) { orderInLayer = newOrderInLayer; }
+
+        private:
+            TextureHandle tileset;
+            int sortingLayer{0};
+            int orderInLayer{0};
+            int tileWidth;
+            int tileHeight;
+            int chunkSize;
+            std::vector<bool> solidTiles;
+            std::map<std::pair<int, int>, TilemapChunk> chunks;
+    };
+
+}
+
+#endif // TILEMAP_H_
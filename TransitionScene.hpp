@@ -10,6 +10,10 @@ namespace spic {
         explicit TransitionScene(size_t transitionTime, std::shared_ptr<spic::Scene> next);
 
         void OnCreate() override;
+
+        /**
+         * Start a tween in Tweens() running for transitionTime, which calls Tick() every frame and Done() at the end.
+         */
         void OnActivate() override;
 
         virtual void Tick(double progress);
@@ -21,6 +25,8 @@ namespace spic {
         std::shared_ptr<spic::Scene> next;
 
         std::shared_ptr<spic::Camera> camera;
+
+        TweenId transitionTween;
     };
 }
 
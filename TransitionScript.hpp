@@ -5,6 +5,11 @@
 #include <functional>
 
 namespace spic {
+    /**
+     * A script calling a function with the progress every frame until maxTime has passed.
+     * For animating many properties, prefer adding tweens to Scene::Tweens(), which are advanced together in one
+     * pass instead of one script each.
+     */
     class TransitionScript : public BehaviourScript {
     public:
         TransitionScript(double maxTime,
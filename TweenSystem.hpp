@@ -0,0 +1,136 @@
+#ifndef TWEENSYSTEM_H_
+#define TWEENSYSTEM_H_
+
+#include "Point.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace spic {
+
+    class GameObject;
+
+    /**
+     * @brief Enumeration for the different easing functions of a tween.
+     * @sharedapi
+     */
+    enum class Easing {
+        linear,
+        easeInQuad,
+        easeOutQuad,
+        easeInOutQuad,
+        easeInCubic,
+        easeOutCubic,
+        easeInOutCubic,
+        count // The amount of easing functions, not an easing itself
+    };
+
+    /**
+     * @brief An identifier of a running tween, 0 means no tween.
+     * @sharedapi
+     */
+    using TweenId = std::uint32_t;
+
+    /**
+     * @brief Animates many double properties from a start to an end value without a script per animation.
+     * @details Tweens are stored in one group of flat arrays per easing, so every easing function is evaluated in
+     *          one tight loop over its tweens. Callbacks of tweens that finished are collected during the pass and
+     *          fired together afterwards, so a callback may safely add or cancel tweens.
+     *          Writing through a raw target pointer is not tracked by GameObject::TransformVersion(); tween game
+     *          object positions with Move(), or call GameObject::MarkTransformChanged() from onUpdate.
+     * @sharedapi
+     */
+    class TweenSystem {
+        public:
+            /**
+             * @brief Start a tween.
+             * @param target The property to animate, must stay valid until the tween finishes or is cancelled.
+             *        May be nullptr when only onUpdate is used, e.g. by TransitionScene.
+             * @param start The value at the start.
+             * @param end The value at the end.
+             * @param duration The duration in seconds. A duration of 0 or less finishes on the next Update():
+             *        the target is set to end, onUpdate is called with 1 and onDone is fired.
+             * @param easing The easing function.
+             * @param onDone An optional function called when the tween finishes.
+             * @param onUpdate An optional function called with the progress (0 to 1) after every update,
+             *        for properties that can not be written through a pointer.
+             * @return The id of the tween.
+             * @sharedapi
+             */
+            TweenId Add(double* target, double start, double end, double duration, Easing easing,
+                        std::function<void()> onDone = nullptr,
+                        std::function<void(double progress)> onUpdate = nullptr);
+
+            /**
+             * @brief Move a game object to a position.
+             * @details Writes the position through the GameObject::Transform() setter every update, so physics and
+             *          the render grid see the move. The tween is cancelled when the game object is destroyed.
+             * @param gameObject The game object to move, held weakly.
+             * @param end The position at the end, the start is the position when the tween is added.
+             * @param duration The duration in seconds, see Add() for 0 or less.
+             * @param easing The easing function.
+             * @param onDone An optional function called when the tween finishes.
+             * @return The id of the tween.
+             * @sharedapi
+             */
+            TweenId Move(const std::shared_ptr<GameObject>& gameObject, Point end, double duration, Easing easing,
+                         std::function<void()> onDone = nullptr);
+
+            /**
+             * @brief Stop a tween without calling its onDone function, the property keeps its current value.
+             * @param id The id of the tween.
+             * @sharedapi
+             */
+            void Cancel(TweenId id);
+
+            /**
+             * @brief Advance all tweens.
+             * @param deltaTime The time in seconds since the last update.
+             * @sharedapi
+             */
+            void Update(double deltaTime);
+
+            /**
+             * @brief The amount of running tweens.
+             * @sharedapi
+             */
+            std::size_t Size() const { return locations.size(); }
+
+            /**
+             * @brief Evaluate an easing function.
+             * @param easing The easing function.
+             * @param t The linear progress, between 0 and 1.
+             * @return The eased progress.
+             * @sharedapi
+             */
+            static double Evaluate(Easing easing, double t);
+
+        private:
+            // The tweens of one easing, removed tweens are filled with the last one of the group
+            struct Group {
+                std::vector<TweenId> ids;
+                std::vector<double*> targets;
+                std::vector<double> starts;
+                std::vector<double> ends;
+                std::vector<double> durations;
+                std::vector<double> elapsed;
+                std::vector<std::function<void()>> doneCallbacks;
+                std::vector<std::function<void(double)>> updateCallbacks;
+            };
+
+            std::array<Group, static_cast<std::size_t>(Easing::count)> groups;
+
+            // Maps a tween to its easing group and index in that group, for Cancel()
+            std::unordered_map<TweenId, std::pair<Easing, std::size_t>> locations;
+            std::vector<std::function<void()>> finished;
+            TweenId nextId{1};
+    };
+
+}
+
+#endif // TWEENSYSTEM_H_
@@ -0,0 +1,111 @@
+/**
+ * Headless render regression check.
+ *
+ * Runs a fixed scene of falling sprites through FrameCapture on the software render backend and compares the
+ * framebuffer hashes and stage timings against a baseline written by an earlier run. Exits with 1 when a frame
+ * renders differently or a stage got slower than the tolerance, so it can be used as a local test target.
+ *
+ * Usage: FrameCaptureCheck <baseline> [frames] [tolerance] [--update]
+ *        --update writes the baseline instead of comparing against it.
+ */
+
+#include "BoxCollider.hpp"
+#include "Camera.hpp"
+#include "Color.hpp"
+#include "Engine.hpp"
+#include "EngineConfig.hpp"
+#include "FrameCapture.hpp"
+#include "GameObject.hpp"
+#include "RigidBody.hpp"
+#include "Scene.hpp"
+#include "Sprite.hpp"
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    void AddBox(spic::Scene& scene, spic::Point position, spic::BodyType bodyType, double width, double height) {
+        auto object = spic::GameObject::CreateWithComponents(std::string{"box"}, std::string{"capture"}, 0,
+            Components{std::make_shared<spic::RigidBody>(1.0, 1.0, bodyType),
+                       std::make_shared<spic::BoxCollider>(width, height, false),
+                       std::make_shared<spic::Sprite>("capture/box.png", spic::Color::red(), false, false, 0, 0)});
+        object->Transform(spic::Transform{position, 0.0, 1.0});
+        scene.Contents().push_back(object);
+    }
+
+    // A camera looking at a ground with a few rows of boxes falling onto it, every frame changes the image
+    std::shared_ptr<spic::Scene> BuildScene() {
+        auto scene = std::make_shared<spic::Scene>();
+        scene->Contents().push_back(spic::GameObject::Create<spic::Camera>(std::string{"camera"}, 0,
+                                                                           spic::Color::white(), 640.0, 480.0));
+        AddBox(*scene, {320.0, 460.0}, spic::BodyType::staticBody, 640.0, 20.0);
+        for (int i = 0; i < 40; ++i) {
+            AddBox(*scene, {40.0 + (i % 10) * 60.0, 40.0 + (i / 10) * 40.0}, spic::BodyType::dynamicBody, 16.0, 16.0);
+        }
+        return scene;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::string usage = std::string{"Usage: "} + argv[0] + " <baseline> [frames] [tolerance] [--update]";
+    const bool update = argc > 1 && std::string{argv[argc - 1]} == "--update";
+    const int positional = update ? argc - 1 : argc;
+    if (positional < 2) {
+        std::cerr << usage << std::endl;
+        return 1;
+    }
+
+    const std::string baselinePath = argv[1];
+    int frames = 300;
+    double tolerance = 1.25;
+
+    try {
+        frames = positional > 2 ? std::stoi(argv[2]) : frames;
+        tolerance = positional > 3 ? std::stod(argv[3]) : tolerance;
+    } catch (const std::exception&) {
+        std::cerr << usage << std::endl;
+        return 1;
+    }
+
+    if (frames < 1 || tolerance < 1.0) {
+        std::cerr << "frames must be at least 1 and tolerance at least 1.0" << std::endl;
+        return 1;
+    }
+
+    spic::EngineConfig config;
+    config.window = {"FrameCaptureCheck", 640, 480, false};
+    config.render.backend = spic::RenderBackendType::software;
+    config.audio.nullOutput = true;
+    config.physics.deterministic = true;
+    spic::Engine::Instance().Init(config);
+
+    spic::FrameCapture capture{static_cast<std::size_t>(frames), 1.0 / 60.0};
+    capture.Run(BuildScene());
+
+    if (update) {
+        capture.Save(baselinePath);
+        std::cout << "Wrote baseline of " << frames << " frames to " << baselinePath << std::endl;
+        return 0;
+    }
+
+    std::vector<spic::FrameProfile> baseline;
+    try {
+        baseline = spic::FrameCapture::Load(baselinePath);
+    } catch (const std::runtime_error& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    const auto result = capture.Compare(baseline, tolerance);
+    if (result.firstMismatchFrame >= 0) {
+        std::cerr << "Frame " << result.firstMismatchFrame << " renders differently from the baseline" << std::endl;
+    }
+    if (result.slowdown > tolerance) {
+        std::cerr << "Stage " << result.slowestStage << " got " << result.slowdown << "x slower" << std::endl;
+    }
+
+    std::cout << (result.passed ? "PASSED" : "FAILED") << std::endl;
+    return result.passed ? 0 : 1;
+}
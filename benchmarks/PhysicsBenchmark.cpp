@@ -0,0 +1,186 @@
+/**
+ * Headless benchmark for the PhysicsManager.
+ *
+ * Builds scenes of RigidBody + BoxCollider/CircleCollider game objects through the public GameObject::Create API,
+ * steps them for a fixed amount of frames without a window or renderer and writes the results as JSON.
+ *
+ * Usage: PhysicsBenchmark [bodies] [frames] [output.json]
+ */
+
+#include "BoxCollider.hpp"
+#include "CircleCollider.hpp"
+#include "Engine.hpp"
+#include "GameObject.hpp"
+#include "IO.hpp"
+#include "PhysicsManager.hpp"
+#include "RigidBody.hpp"
+#include "Scene.hpp"
+#include "Time.hpp"
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Scenario {
+        std::string name;
+        std::function<void(spic::Scene&, int)> build;
+    };
+
+    struct Result {
+        std::string name;
+        int bodies;
+        int frames;
+        double nsPerBodyStep;
+        spic::PhysicsStats stats;
+    };
+
+    void AddObject(spic::Scene& scene, const std::string& name, spic::Point position, Components components) {
+        auto object = spic::GameObject::CreateWithComponents(name, std::string{"benchmark"}, 0, components);
+        object->Transform().position = position;
+        scene.Contents().push_back(object);
+    }
+
+    void AddGround(spic::Scene& scene, double width) {
+        AddObject(scene, "ground", {width / 2.0, 1000.0},
+                  {std::make_shared<spic::RigidBody>(0.0, 0.0, spic::BodyType::staticBody),
+                   std::make_shared<spic::BoxCollider>(width, 20.0, false)});
+    }
+
+    Components DynamicBox() {
+        return {std::make_shared<spic::RigidBody>(1.0, 1.0, spic::BodyType::dynamicBody),
+                std::make_shared<spic::BoxCollider>(16.0, 16.0, false)};
+    }
+
+    Components DynamicCircle() {
+        return {std::make_shared<spic::RigidBody>(1.0, 1.0, spic::BodyType::dynamicBody),
+                std::make_shared<spic::CircleCollider>(8.0, false)};
+    }
+
+    // Columns of boxes resting on each other, most bodies stay in contact the whole run
+    void BuildStacking(spic::Scene& scene, int bodies) {
+        const int columns = static_cast<int>(std::sqrt(bodies));
+        AddGround(scene, columns * 20.0);
+        for (int i = 0; i < bodies; ++i) {
+            AddObject(scene, "box", {(i % columns) * 20.0, 990.0 - (i / columns) * 16.0}, DynamicBox());
+        }
+    }
+
+    // Circles falling from random heights onto the ground
+    void BuildRain(spic::Scene& scene, int bodies) {
+        std::mt19937 random{42};
+        std::uniform_real_distribution<double> x{0.0, 2000.0};
+        std::uniform_real_distribution<double> y{-5000.0, 900.0};
+        AddGround(scene, 2000.0);
+        for (int i = 0; i < bodies; ++i) {
+            AddObject(scene, "drop", {x(random), y(random)}, DynamicCircle());
+        }
+    }
+
+    // A tightly packed grid of circles, every body overlaps its neighbours in the broadphase
+    void BuildCrowd(spic::Scene& scene, int bodies) {
+        const int columns = static_cast<int>(std::sqrt(bodies));
+        AddGround(scene, columns * 15.0);
+        for (int i = 0; i < bodies; ++i) {
+            AddObject(scene, "crowd", {(i % columns) * 15.0, 990.0 - (i / columns) * 15.0}, DynamicCircle());
+        }
+    }
+
+    // Boxes far apart without gravity, measures the per-body overhead without any pairs
+    void BuildSparse(spic::Scene& scene, int bodies) {
+        const int columns = static_cast<int>(std::sqrt(bodies));
+        for (int i = 0; i < bodies; ++i) {
+            AddObject(scene, "sparse", {(i % columns) * 500.0, (i / columns) * 500.0},
+                      {std::make_shared<spic::RigidBody>(1.0, 0.0, spic::BodyType::dynamicBody),
+                       std::make_shared<spic::BoxCollider>(16.0, 16.0, false)});
+        }
+    }
+
+    Result Run(const Scenario& scenario, int bodies, int frames) {
+        auto& engine = spic::Engine::Instance();
+        auto scene = std::make_shared<spic::Scene>();
+        scenario.build(*scene, bodies);
+        engine.PushScene(scene);
+
+        const auto& physics = engine.PhysicsManager();
+        spic::Time::DeltaTime(1.0 / 60.0);
+        spic::Time::TimeScale(1.0);
+
+        // The first update creates the bodies, keep it out of the measurement
+        physics->Update();
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame) {
+            physics->Update();
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        const auto ns = std::chrono::duration<double, std::nano>(end - start).count();
+        Result result{scenario.name, bodies, frames, ns / (static_cast<double>(bodies) * frames), physics->Stats()};
+
+        engine.PopScene();
+        physics->ResetWorld();
+        return result;
+    }
+
+    void WriteJson(std::ostream& out, const std::vector<Result>& results) {
+        out << "{\n  \"benchmark\": \"physics\",\n  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const auto& r = results[i];
+            out << "    {\"scenario\": \"" << r.name << "\""
+                << ", \"bodies\": " << r.bodies
+                << ", \"frames\": " << r.frames
+                << ", \"ns_per_body_step\": " << r.nsPerBodyStep
+                << ", \"awake_bodies\": " << r.stats.awakeBodies
+                << ", \"broadphase_pairs\": " << r.stats.broadphasePairs
+                << ", \"contacts\": " << r.stats.contacts
+                << ", \"memory_bytes\": " << r.stats.memoryBytes << "}"
+                << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        out << "  ]\n}\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int bodies = 1000;
+    int frames = 600;
+
+    try {
+        bodies = argc > 1 ? std::stoi(argv[1]) : bodies;
+        frames = argc > 2 ? std::stoi(argv[2]) : frames;
+    } catch (const std::exception&) {
+        std::cerr << "Usage: " << argv[0] << " [bodies] [frames] [output.json]" << std::endl;
+        return 1;
+    }
+
+    // Both end up in the divisor of ns/body/step and bodies is used as a grid size, zero or negative values
+    // would produce nan/inf in the JSON output
+    if (bodies < 1 || frames < 1) {
+        std::cerr << "bodies and frames must be at least 1" << std::endl;
+        return 1;
+    }
+
+    const std::vector<Scenario> scenarios{
+        {"stacking", BuildStacking},
+        {"rain", BuildRain},
+        {"crowd", BuildCrowd},
+        {"sparse", BuildSparse},
+    };
+
+    std::vector<Result> results;
+    for (const auto& scenario : scenarios) {
+        results.push_back(Run(scenario, bodies, frames));
+    }
+
+    if (argc > 3) {
+        spic::io::OpenFileForWriting(argv[3], [&results](std::ostream& out) { WriteJson(out, results); });
+    } else {
+        WriteJson(std::cout, results);
+    }
+
+    return 0;
+}
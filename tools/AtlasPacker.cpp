@@ -0,0 +1,48 @@
+/**
+ * Offline texture atlas packer.
+ *
+ * Packs every image in an asset directory into atlas pages and writes the pages with a manifest that maps the
+ * original Sprite::Texture() paths to a page and UV rectangle.
+ *
+ * Usage: AtlasPacker <asset directory> <manifest> [page width] [page height]
+ */
+
+#include "TextureAtlas.hpp"
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <asset directory> <manifest> [page width] [page height]" << std::endl;
+        return 1;
+    }
+
+    int pageWidth = 2048;
+    int pageHeight = 0;
+
+    try {
+        pageWidth = argc > 3 ? std::stoi(argv[3]) : pageWidth;
+        pageHeight = argc > 4 ? std::stoi(argv[4]) : pageWidth;
+    } catch (const std::exception&) {
+        std::cerr << "Usage: " << argv[0] << " <asset directory> <manifest> [page width] [page height]" << std::endl;
+        return 1;
+    }
+
+    // A page without area can not hold any image and the SkylinePacker would start with an empty skyline
+    if (pageWidth < 1 || pageHeight < 1) {
+        std::cerr << "page width and height must be at least 1" << std::endl;
+        return 1;
+    }
+
+    spic::TextureAtlas atlas{pageWidth, pageHeight};
+    const int packed = atlas.Build(argv[1]);
+
+    if (!atlas.Save(argv[2])) {
+        std::cerr << "Could not write atlas to " << argv[2] << std::endl;
+        return 1;
+    }
+
+    std::cout << "Packed " << packed << " images into " << atlas.PageCount() << " pages" << std::endl;
+    return 0;
+}